@@ -24,6 +24,10 @@
 #include "dv_ros2_msgs/msg/event.hpp"
 #include "dv_ros2_msgs/msg/event_array.hpp"
 #include "dv_ros2_msgs/msg/event_packet.hpp"
+#include "dv_ros2_msgs/msg/packed_event_array.hpp"
+#include "dv_ros2_msgs/msg/compressed_event_packet.hpp"
+#include "dv_ros2_messaging/demand.hpp"
+#include "dv_ros2_messaging/image_pool.hpp"
 #include "dv_ros2_messaging/messaging.hpp"
 
 namespace dv_ros2_accumulation
@@ -64,6 +68,10 @@ namespace dv_ros2_accumulation
         bool enable_decay = false;
         /// @brief Slope for linear decay, tau for  exponential decay, time for step decay [0.0, 1.0]
         double decay_edge = 0.1;
+        /// @brief Subscribe to the compact packed event topic instead of the event packet topic
+        bool packed_events = false;
+        /// @brief Subscribe to the compressed event topic, takes precedence over packed_events
+        bool compressed_events = false;
     };
     class Accumulator : public rclcpp::Node
     {
@@ -71,7 +79,12 @@ namespace dv_ros2_accumulation
     public:
         /// @brief Default constructor
         /// @param t_node_name name of the node
-        Accumulator(const std::string &t_node_name);
+        /// @param options node options
+        Accumulator(const std::string &t_node_name, const rclcpp::NodeOptions &options = rclcpp::NodeOptions());
+
+        /// @brief Component constructor, registers the parameter callback and starts the node.
+        /// @param options node options passed by the component container
+        explicit Accumulator(const rclcpp::NodeOptions &options);
 
         /// @brief Shallow copy constructor
         /// @param source to copy from
@@ -108,8 +121,24 @@ namespace dv_ros2_accumulation
         /// @brief Event callback function for populating queue
         /// @param events EventArray message
         ///void eventCallback(dv_ros2_msgs::msg::EventArray::SharedPtr events);
-        void eventCallback(dv_ros2_msgs::msg::EventPacket::SharedPtr events);
+        void eventCallback(dv_ros2_msgs::EventStorePacket::ConstSharedPtr events);
+
+        /// @brief Packed event callback function for populating queue
+        /// @param events PackedEventArray message
+        void packedEventCallback(dv_ros2_msgs::msg::PackedEventArray::SharedPtr events);
+
+        /// @brief Compressed event callback function for populating queue
+        /// @param events CompressedEventPacket message
+        void compressedEventCallback(dv_ros2_msgs::msg::CompressedEventPacket::SharedPtr events);
 
+        /// @brief Pass the received events to the slicer, creates the accumulators on first call
+        /// @param resolution Resolution of the sensor
+        /// @param store Received events
+        void acceptEvents(const cv::Size &resolution, const dv::EventStore &store);
+
+        /// @brief Poll the subscribers of the frame publisher, restarts the slicer when the first subscriber appears
+        /// @return True if the received events have to be accumulated, false if nobody listens to the frames
+        bool hasDemand();
 
         /// @brief Accumulation thread
         void accumulate();
@@ -120,9 +149,12 @@ namespace dv_ros2_accumulation
         /// @brief Update configuration for reconfiguration while running
         void updateConfiguration();
 
-        /// @brief rclcpp node pointer
+        /// @brief rclcpp node pointer, non-owning
         rclcpp::Node::SharedPtr m_node;
 
+        /// @brief Handle of the parameter callback registered by the component constructor
+        rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr m_params_callback_handle;
+
         /// @brief Params struct
         Params m_params;
 
@@ -132,11 +164,23 @@ namespace dv_ros2_accumulation
 
         // EventArray subscriber
         //rclcpp::Subscription<dv_ros2_msgs::msg::EventArray>::SharedPtr m_events_subscriber;
-        rclcpp::Subscription<dv_ros2_msgs::msg::EventPacket>::SharedPtr m_events_subscriber;
+        rclcpp::Subscription<dv_ros2_msgs::EventStorePacket>::SharedPtr m_events_subscriber;
+
+        // PackedEventArray subscriber
+        rclcpp::Subscription<dv_ros2_msgs::msg::PackedEventArray>::SharedPtr m_packed_events_subscriber;
+
+        // CompressedEventPacket subscriber
+        rclcpp::Subscription<dv_ros2_msgs::msg::CompressedEventPacket>::SharedPtr m_compressed_events_subscriber;
 
         /// @brief Frame publisher
         rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr m_frame_publisher;
 
+        /// @brief Subscriber demand of the frame publisher, no events are sliced or accumulated without it
+        dv_ros2_msgs::PublisherDemand m_frame_demand;
+
+        /// @brief Recycled image messages, avoids a buffer allocation for every published frame
+        dv_ros2_msgs::ImageMessagePool m_image_pool;
+
         boost::lockfree::spsc_queue<dv::EventStore> m_event_queue{100};
         
         std::unique_ptr<dv::Accumulator> m_accumulator = nullptr;
@@ -30,6 +30,8 @@ def generate_launch_description():
             emulate_tty=True,
             remappings=[
                 (f'/{acc_node_name}/events', '/events'),            
+                (f'/{acc_node_name}/events_packed', '/events_packed'),
+                (f'/{acc_node_name}/events_compressed', '/events_compressed'),
             ]
         ),
         Node(
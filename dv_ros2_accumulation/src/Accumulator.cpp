@@ -2,8 +2,8 @@
 
 namespace dv_ros2_accumulation
 {
-    Accumulator::Accumulator(const std::string &t_node_name)
-    : Node(t_node_name), m_node{this}
+    Accumulator::Accumulator(const std::string &t_node_name, const rclcpp::NodeOptions &options)
+    : Node(t_node_name, options), m_node{this, [](rclcpp::Node *) {}}
     {
         RCLCPP_INFO(m_node->get_logger(), "Constructor is initialized");
         parameterInitilization();
@@ -18,13 +18,32 @@ namespace dv_ros2_accumulation
         parameterPrinter();
 
         //m_events_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::EventArray>("events", 10, std::bind(&Accumulator::eventCallback, this, std::placeholders::_1));
-        m_events_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::EventPacket>("events", 10, std::bind(&Accumulator::eventCallback, this, std::placeholders::_1));
+        if (m_params.compressed_events)
+        {
+            m_compressed_events_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::CompressedEventPacket>("events_compressed", 10, std::bind(&Accumulator::compressedEventCallback, this, std::placeholders::_1));
+        }
+        else if (m_params.packed_events)
+        {
+            m_packed_events_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::PackedEventArray>("events_packed", 10, std::bind(&Accumulator::packedEventCallback, this, std::placeholders::_1));
+        }
+        else
+        {
+            m_events_subscriber = m_node->create_subscription<dv_ros2_msgs::EventStorePacket>("events", 10, std::bind(&Accumulator::eventCallback, this, std::placeholders::_1));
+        }
         m_frame_publisher = m_node->create_publisher<sensor_msgs::msg::Image>("image", 10);
+        m_frame_demand.track(m_frame_publisher);
         m_slicer = std::make_unique<dv::EventStreamSlicer>();
 
         RCLCPP_INFO(m_node->get_logger(), "Successfully launched.");
     }
 
+    Accumulator::Accumulator(const rclcpp::NodeOptions &options)
+    : Accumulator("dv_ros2_accumulation", options)
+    {
+        m_params_callback_handle = add_on_set_parameters_callback(std::bind(&Accumulator::paramsCallback, this, std::placeholders::_1));
+        start();
+    }
+
     void Accumulator::start()
     {
         m_accumulation_thread = std::thread(&Accumulator::accumulate, this);
@@ -36,6 +55,7 @@ namespace dv_ros2_accumulation
         RCLCPP_INFO(m_node->get_logger(), "Stopping the accumulation node...");
         m_spin_thread = false;
         m_accumulation_thread.join();
+        RCLCPP_INFO_STREAM(m_node->get_logger(), "Image message pool: " << m_image_pool.hits() << " hits, " << m_image_pool.misses() << " misses.");
     }
 
     bool Accumulator::isRunning() const
@@ -44,20 +64,46 @@ namespace dv_ros2_accumulation
     }
 
     //void Accumulator::eventCallback(dv_ros2_msgs::msg::EventArray::SharedPtr events)
-    void Accumulator::eventCallback(dv_ros2_msgs::msg::EventPacket::SharedPtr events)
+    void Accumulator::eventCallback(dv_ros2_msgs::EventStorePacket::ConstSharedPtr events)
     {
-            if (m_accumulator == nullptr)
-            {
-                m_accumulator = std::make_unique<dv::Accumulator>(cv::Size(events->width, events->height));
-                updateConfiguration();
-            }
-        
-            if (m_accumulator_edge == nullptr)
-            {
-                m_accumulator_edge = std::make_unique<dv::EdgeMapAccumulator>(cv::Size(events->width, events->height));
-                updateConfiguration();
-            }
-        auto store = dv_ros2_msgs::toEventStore(*events);
+        if (!hasDemand())
+        {
+            return;
+        }
+        acceptEvents(events->resolution, events->events);
+    }
+
+    void Accumulator::packedEventCallback(dv_ros2_msgs::msg::PackedEventArray::SharedPtr events)
+    {
+        if (!hasDemand())
+        {
+            return;
+        }
+        acceptEvents(cv::Size(events->width, events->height), dv_ros2_msgs::toEventStore(*events));
+    }
+
+    void Accumulator::compressedEventCallback(dv_ros2_msgs::msg::CompressedEventPacket::SharedPtr events)
+    {
+        if (!hasDemand())
+        {
+            return;
+        }
+        acceptEvents(cv::Size(events->width, events->height), dv_ros2_msgs::toEventStore(*events));
+    }
+
+    void Accumulator::acceptEvents(const cv::Size &resolution, const dv::EventStore &store)
+    {
+        if (m_accumulator == nullptr)
+        {
+            m_accumulator = std::make_unique<dv::Accumulator>(resolution);
+            updateConfiguration();
+        }
+
+        if (m_accumulator_edge == nullptr)
+        {
+            m_accumulator_edge = std::make_unique<dv::EdgeMapAccumulator>(resolution);
+            updateConfiguration();
+        }
 
         try
         {
@@ -70,6 +116,28 @@ namespace dv_ros2_accumulation
 
     }
 
+    bool Accumulator::hasDemand()
+    {
+        switch (m_frame_demand.poll())
+        {
+            case dv_ros2_msgs::PublisherDemand::State::Idle:
+                return false;
+            case dv_ros2_msgs::PublisherDemand::State::Resumed:
+                // Start slicing from the next received events, a time job would otherwise emit every interval skipped
+                // while idle
+                RCLCPP_INFO(m_node->get_logger(), "Frame subscriber connected, resuming accumulation.");
+                m_slicer = std::make_unique<dv::EventStreamSlicer>();
+                m_job_id.reset();
+                if (m_accumulator != nullptr)
+                {
+                    updateConfiguration();
+                }
+                return true;
+            default:
+                return true;
+        }
+    }
+
     void Accumulator::slicerCallback(const dv::EventStore &events)
     {
         m_event_queue.push(events);
@@ -137,15 +205,18 @@ namespace dv_ros2_accumulation
         
         while (m_spin_thread)
         {
-            if (m_params.accumulation_mode == "FRAME" ? m_accumulator != nullptr : m_accumulator_edge != nullptr)
+            if (!m_frame_demand.active())
+            {
+                // Drop the slices left over from before the last subscriber disconnected
+                m_event_queue.consume_all([](const dv::EventStore &) {});
+            }
+            else if (m_params.accumulation_mode == "FRAME" ? m_accumulator != nullptr : m_accumulator_edge != nullptr)
             {
                 m_event_queue.consume_all([&](const dv::EventStore &events)
                 {
                     m_params.accumulation_mode == "FRAME" ? m_accumulator->accumulate(events) : m_accumulator_edge->accumulate(events);
                     dv::Frame frame = m_params.accumulation_mode == "FRAME" ? m_accumulator->generateFrame() : m_accumulator_edge->generateFrame();
-                    sensor_msgs::msg::Image msg = dv_ros2_msgs::toRosImageMessage(frame.image);
-                    msg.header.stamp = dv_ros2_msgs::toRosTime(frame.timestamp);
-                    m_frame_publisher->publish(msg);
+                    m_image_pool.publish(*m_frame_publisher, frame.image, dv_ros2_msgs::toRosTime(frame.timestamp));
                 });
             }
             std::this_thread::sleep_for(std::chrono::microseconds(100));
@@ -159,7 +230,6 @@ namespace dv_ros2_accumulation
     {
         RCLCPP_INFO(m_node->get_logger(), "Destructor is activated. ");
         stop();
-        rclcpp::shutdown();
     }
 
     inline void Accumulator::parameterInitilization() const
@@ -191,6 +261,10 @@ namespace dv_ros2_accumulation
         float_range.set__from_value(0.0).set__to_value(1.0);
         descriptor.floating_point_range = {float_range};
         m_node->declare_parameter("decay_edge", m_params.decay_edge, descriptor);
+        rcl_interfaces::msg::ParameterDescriptor read_only_descriptor;
+        read_only_descriptor.read_only = true;
+        m_node->declare_parameter("packed_events", m_params.packed_events, read_only_descriptor);
+        m_node->declare_parameter("compressed_events", m_params.compressed_events, read_only_descriptor);
     }
 
     inline void Accumulator::parameterPrinter() const
@@ -210,6 +284,8 @@ namespace dv_ros2_accumulation
         RCLCPP_INFO(m_node->get_logger(), "accumulation_mode: %s", m_params.accumulation_mode.c_str());
         RCLCPP_INFO(m_node->get_logger(), "enable_decay: %s", m_params.enable_decay ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "decay_edge: %s", m_params.decay_edge ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "packed_events: %s", m_params.packed_events ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "compressed_events: %s", m_params.compressed_events ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "-----------------------------");
     }
 
@@ -285,6 +361,16 @@ namespace dv_ros2_accumulation
             RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter decay_edge");
             return false;
         }
+        if (!m_node->get_parameter("packed_events", m_params.packed_events))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter packed_events");
+            return false;
+        }
+        if (!m_node->get_parameter("compressed_events", m_params.compressed_events))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter compressed_events");
+            return false;
+        }
         return true;
     }
 
@@ -474,4 +560,7 @@ namespace dv_ros2_accumulation
         return result;
     }
 
-}  // namespace dv_ros2_accumulation
\ No newline at end of file
+}  // namespace dv_ros2_accumulation
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(dv_ros2_accumulation::Accumulator)
@@ -0,0 +1,43 @@
+#!/usr/bin/env bash
+# Measures convert_aedat4 on a synthetic recording with one and all worker threads and with every storage and
+# compression combination, and prints the results as markdown tables.
+# Usage: benchmark_conversion.sh [duration in seconds] [events per second]
+set -euo pipefail
+
+duration=${1:-60}
+eventRate=${2:-5000000}
+workdir=$(mktemp -d)
+trap 'rm -rf "${workdir}"' EXIT
+
+recording="${workdir}/synthetic.aedat4"
+ros2 run dv_ros2_aedat4 generate_recording -o "${recording}" -d "${duration}" -r "${eventRate}"
+echo "Recording: ${duration} s, ${eventRate} events/s, $(du -m "${recording}" | cut -f1) MiB, $(nproc) CPU cores"
+echo
+
+# Converts the recording with the given options and prints one table row with the measurements reported by -v
+convert() {
+	local label=$1
+	shift
+	local log
+	log=$(ros2 run dv_ros2_aedat4 convert_aedat4 -i "${recording}" -o "${workdir}/bag" -f -v "$@" | tr '\r' '\n')
+	local seconds rate realTime size
+	seconds=$(sed -nE 's/^Converted [0-9]+ messages in ([0-9.e+-]+) s .*/\1/p' <<< "${log}")
+	rate=$(sed -nE 's/.*\(([0-9.e+-]+) messages\/s, .*/\1/p' <<< "${log}")
+	realTime=$(sed -nE 's/.*, ([0-9.e+-]+)x real time\).*/\1/p' <<< "${log}")
+	size=$(sed -nE 's/^Wrote ([0-9.e+-]+) MiB .*/\1/p' <<< "${log}")
+	printf '| %s | %.2f | %.0f | %.1f | %.1f |\n' "${label}" "${seconds}" "${rate}" "${realTime}" "${size}"
+}
+
+echo "| Workers | Time (s) | Messages/s | Real-time factor | Bag size (MiB) |"
+echo "|---------|----------|------------|------------------|----------------|"
+convert "\`-j 1\`"
+convert "default (\`-j $(nproc)\`)"
+echo
+
+echo "| Storage, compression | Time (s) | Messages/s | Real-time factor | Bag size (MiB) |"
+echo "|----------------------|----------|------------|------------------|----------------|"
+for storage in sqlite3 mcap; do
+	for compression in none file message; do
+		convert "\`${storage}\`, \`${compression}\`" -s "${storage}" -c "${compression}"
+	done
+done
@@ -0,0 +1,210 @@
+#include <dv-processing/io/mono_camera_writer.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <opencv2/imgproc.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+/**
+ * Duration in microseconds of the event packets written into the recording, matches the packets of a live camera.
+ */
+constexpr int64_t packetDuration = 1'000;
+
+/**
+ * Timestamp of the first packet, a wall clock time like the timestamps of a camera.
+ */
+constexpr int64_t recordingStart = 1'700'000'000'000'000;
+
+/**
+ * Position of the synthetic edge sweeping over the sensor, one pass every two seconds.
+ */
+float edgePosition(const int64_t timestamp, const int width) {
+	const double phase = static_cast<double>(timestamp % 2'000'000) / 2'000'000.0;
+	return static_cast<float>(width) * static_cast<float>(0.5 - 0.5 * std::cos(2.0 * 3.14159265358979 * phase));
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+	namespace fs = std::filesystem;
+
+	CLI::App app{"Synthetic aedat4 recording generator. Writes a recording of the requested duration and event rate "
+				 "with a moving edge, frames, IMU and triggers, to measure the throughput of convert_aedat4."};
+
+	std::string output;
+	double duration         = 60.0;
+	double eventRate        = 5'000'000.0;
+	int width               = 640;
+	int height              = 480;
+	double frameRate        = 30.0;
+	double imuRate          = 1'000.0;
+	double triggerRate      = 10.0;
+	double noise            = 0.2;
+	uint32_t seed           = 0;
+	std::string compression = "lz4";
+	bool overwrite          = false;
+	app.add_option("-o,--output", output, "Output aedat4 file path")->required();
+	app.add_option("-d,--duration", duration, "Recording duration in seconds")
+		->check(CLI::PositiveNumber)
+		->capture_default_str();
+	app.add_option("-r,--event-rate", eventRate, "Events per second")
+		->check(CLI::PositiveNumber)
+		->capture_default_str();
+	app.add_option("--width", width, "Sensor width")->check(CLI::Range(16, 4096))->capture_default_str();
+	app.add_option("--height", height, "Sensor height")->check(CLI::Range(16, 4096))->capture_default_str();
+	app.add_option("--frame-rate", frameRate, "Frames per second, 0 disables the frame stream")
+		->check(CLI::NonNegativeNumber)
+		->capture_default_str();
+	app.add_option("--imu-rate", imuRate, "IMU samples per second, 0 disables the IMU stream")
+		->check(CLI::NonNegativeNumber)
+		->capture_default_str();
+	app.add_option("--trigger-rate", triggerRate, "Triggers per second, 0 disables the trigger stream")
+		->check(CLI::NonNegativeNumber)
+		->capture_default_str();
+	app.add_option("--noise", noise, "Fraction of events spread uniformly over the sensor instead of the edge")
+		->check(CLI::Range(0.0, 1.0))
+		->capture_default_str();
+	app.add_option("--seed", seed, "Seed of the random generator")->capture_default_str();
+	app.add_option("-c,--compression", compression, "Packet compression of the aedat4 file")
+		->check(CLI::IsMember({"none", "lz4", "lz4_high", "zstd", "zstd_high"}))
+		->capture_default_str();
+	app.add_flag("-f,--force-overwrite", overwrite);
+
+	CLI11_PARSE(app, argc, argv);
+
+	if (fs::exists(output) && !overwrite) {
+		std::cout << "Output file already exists, use -f to overwrite it" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const cv::Size resolution(width, height);
+	dv::io::MonoCameraWriter::Config config("synthetic");
+	const std::map<std::string, dv::CompressionType> compressionTypes = {
+		{"none", dv::CompressionType::NONE},
+		{"lz4", dv::CompressionType::LZ4},
+		{"lz4_high", dv::CompressionType::LZ4_HIGH},
+		{"zstd", dv::CompressionType::ZSTD},
+		{"zstd_high", dv::CompressionType::ZSTD_HIGH},
+	};
+	config.compression = compressionTypes.at(compression);
+	config.addEventStream(resolution);
+	if (frameRate > 0.0) {
+		config.addFrameStream(resolution);
+	}
+	if (imuRate > 0.0) {
+		config.addImuStream();
+	}
+	if (triggerRate > 0.0) {
+		config.addTriggerStream();
+	}
+
+	// The writer finishes the file when it is destroyed at the end of this scope
+	{
+		dv::io::MonoCameraWriter writer(output, config);
+
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+		std::normal_distribution<float> edgeSpread(0.0f, 1.5f);
+		std::uniform_int_distribution<int16_t> column(0, static_cast<int16_t>(width - 1));
+		std::uniform_int_distribution<int16_t> row(0, static_cast<int16_t>(height - 1));
+		std::uniform_int_distribution<int64_t> offset(0, packetDuration - 1);
+
+		const int64_t end            = recordingStart + static_cast<int64_t>(duration * 1e6);
+		const double eventsPerPacket = eventRate * static_cast<double>(packetDuration) * 1e-6;
+
+		const auto period = [](const double rate) {
+			return rate > 0.0 ? std::max(static_cast<int64_t>(1e6 / rate), int64_t{1}) : int64_t{0};
+		};
+		const int64_t framePeriod   = period(frameRate);
+		const int64_t imuPeriod     = period(imuRate);
+		const int64_t triggerPeriod = period(triggerRate);
+
+		double eventBudget = 0.0;
+		std::vector<int64_t> timestamps;
+		dv::IMUPacket imuPacket;
+		dv::TriggerPacket triggerPacket;
+		for (int64_t packetStart = recordingStart; packetStart < end; packetStart += packetDuration) {
+			// Events are spread uniformly over the packet, along the edge or over the whole sensor
+			eventBudget += eventsPerPacket;
+			const auto count = static_cast<size_t>(eventBudget);
+			eventBudget -= static_cast<double>(count);
+			timestamps.resize(count);
+			for (auto &timestamp : timestamps) {
+				timestamp = packetStart + offset(generator);
+			}
+			std::sort(timestamps.begin(), timestamps.end());
+
+			dv::EventStore events;
+			for (const int64_t timestamp : timestamps) {
+				if (unit(generator) < noise) {
+					events.emplace_back(timestamp, column(generator), row(generator), unit(generator) < 0.5f);
+					continue;
+				}
+				const float edge  = edgePosition(timestamp, width - 1);
+				const auto x
+					= static_cast<int16_t>(std::clamp(edge + edgeSpread(generator), 0.0f, static_cast<float>(width - 1)));
+				const bool rising = edgePosition(timestamp + 1'000, width - 1) > edge;
+				events.emplace_back(timestamp, x, row(generator), rising);
+			}
+			if (!events.isEmpty()) {
+				writer.writeEvents(events);
+			}
+
+			const int64_t packetEnd = packetStart + packetDuration;
+			if (framePeriod > 0) {
+				for (int64_t timestamp = ((packetStart + framePeriod - 1) / framePeriod) * framePeriod;
+					 timestamp < packetEnd; timestamp += framePeriod) {
+					cv::Mat image(resolution, CV_8UC1, cv::Scalar(64));
+					const int edge = static_cast<int>(edgePosition(timestamp, width - 1));
+					cv::rectangle(
+						image, cv::Point(edge, 0), cv::Point(width - 1, height - 1), cv::Scalar(192), cv::FILLED);
+					writer.writeFrame(dv::Frame(timestamp, image));
+				}
+			}
+
+			if (imuPeriod > 0) {
+				imuPacket.elements.clear();
+				for (int64_t timestamp = ((packetStart + imuPeriod - 1) / imuPeriod) * imuPeriod; timestamp < packetEnd;
+					 timestamp += imuPeriod) {
+					dv::IMU imu{};
+					imu.timestamp      = timestamp;
+					imu.temperature    = 25.0f;
+					imu.accelerometerX = 0.01f * (unit(generator) - 0.5f);
+					imu.accelerometerY = 0.01f * (unit(generator) - 0.5f);
+					imu.accelerometerZ = -1.0f + 0.01f * (unit(generator) - 0.5f);
+					imu.gyroscopeX     = 0.1f * (unit(generator) - 0.5f);
+					imu.gyroscopeY     = 0.1f * (unit(generator) - 0.5f);
+					imu.gyroscopeZ     = 0.1f * (unit(generator) - 0.5f);
+					imuPacket.elements.push_back(imu);
+				}
+				if (!imuPacket.elements.empty()) {
+					writer.writeImuPacket(imuPacket);
+				}
+			}
+
+			if (triggerPeriod > 0) {
+				triggerPacket.elements.clear();
+				for (int64_t timestamp = ((packetStart + triggerPeriod - 1) / triggerPeriod) * triggerPeriod;
+					 timestamp < packetEnd; timestamp += triggerPeriod) {
+					triggerPacket.elements.emplace_back(timestamp, dv::TriggerType::EXTERNAL_SIGNAL_RISING_EDGE);
+				}
+				if (!triggerPacket.elements.empty()) {
+					writer.writeTriggerPacket(triggerPacket);
+				}
+			}
+		}
+	}
+
+	std::cout << "Wrote " << duration << " s at " << eventRate << " events/s to " << output << " ("
+			  << static_cast<double>(fs::file_size(output)) / (1024.0 * 1024.0) << " MiB)" << std::endl;
+
+	return EXIT_SUCCESS;
+}
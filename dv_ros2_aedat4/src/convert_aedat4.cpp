@@ -4,9 +4,230 @@
 
 #include <CLI/CLI.hpp>
 
+#include <rclcpp/serialization.hpp>
+#include <rosbag2_compression/compression_options.hpp>
+#include <rosbag2_compression/sequential_compression_writer.hpp>
 #include <rosbag2_cpp/writer.hpp>
+#include <rosbag2_storage/storage_options.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <filesystem>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace {
+
+/**
+ * Duration in microseconds of the time windows read from the recording index.
+ */
+constexpr int64_t readWindow = 10'000;
+
+/**
+ * Message serialized by a conversion worker, ready to be written into the bag.
+ */
+struct BagMessage {
+	std::string topic;
+	std::string type;
+	rclcpp::Time time;
+	std::shared_ptr<rclcpp::SerializedMessage> data;
+};
+
+/**
+ * Packet read from the recording, the sequence number defines the order in which the converted messages are written.
+ */
+struct ConversionJob {
+	uint64_t sequence;
+	std::variant<dv::Frame, dv::EventStore, dv::cvector<dv::IMU>, dv::cvector<dv::Trigger>> data;
+};
+
+/**
+ * Messages converted from a single job.
+ */
+struct ConversionResult {
+	uint64_t sequence;
+	std::vector<BagMessage> messages;
+};
+
+/**
+ * Bounded multi-producer multi-consumer queue connecting the pipeline stages. Producers block while the queue is
+ * full, which keeps the memory use of the pipeline bounded when the bag writer is the bottleneck.
+ */
+template<class T>
+class BlockingQueue {
+public:
+	explicit BlockingQueue(const size_t capacity) : mCapacity(std::max<size_t>(capacity, 1)) {
+	}
+
+	/**
+	 * Push an element, blocks while the queue is full.
+	 * @return False if the queue was closed and the element was dropped.
+	 */
+	bool push(T element) {
+		std::unique_lock<std::mutex> lock(mMutex);
+		mNotFull.wait(lock, [this] {
+			return mClosed || mElements.size() < mCapacity;
+		});
+		if (mClosed) {
+			return false;
+		}
+		mElements.push_back(std::move(element));
+		mNotEmpty.notify_one();
+		return true;
+	}
+
+	/**
+	 * Pop an element, blocks while the queue is empty.
+	 * @return Element, or std::nullopt once the queue is closed and drained.
+	 */
+	std::optional<T> pop() {
+		std::unique_lock<std::mutex> lock(mMutex);
+		mNotEmpty.wait(lock, [this] {
+			return mClosed || !mElements.empty();
+		});
+		if (mElements.empty()) {
+			return std::nullopt;
+		}
+		T element = std::move(mElements.front());
+		mElements.pop_front();
+		mNotFull.notify_one();
+		return element;
+	}
+
+	/**
+	 * Close the queue, remaining elements can still be popped.
+	 */
+	void close() {
+		std::lock_guard<std::mutex> lock(mMutex);
+		mClosed = true;
+		mNotEmpty.notify_all();
+		mNotFull.notify_all();
+	}
+
+private:
+	size_t mCapacity;
+	std::mutex mMutex;
+	std::condition_variable mNotEmpty;
+	std::condition_variable mNotFull;
+	std::deque<T> mElements;
+	bool mClosed = false;
+};
+
+template<class MessageT>
+BagMessage serializeMessage(const MessageT &message, const std::string &topic, const rclcpp::Time &time) {
+	static const rclcpp::Serialization<MessageT> serialization;
+
+	BagMessage bagMessage{topic, rosidl_generator_traits::name<MessageT>(), time,
+		std::make_shared<rclcpp::SerializedMessage>()};
+	serialization.serialize_message(&message, bagMessage.data.get());
+	return bagMessage;
+}
+
+/**
+ * Converts recording packets into serialized bag messages, called concurrently from the worker threads.
+ */
+struct MessageConverter {
+	std::string topicNamespace;
+	std::optional<cv::Size> eventResolution;
+	bool batch = false;
+	std::optional<cv::Rect> eventRoi;
+	size_t eventDecimation = 1;
+
+	/**
+	 * Crop the events to the region of interest, shifted to its origin, and keep every n-th remaining event.
+	 */
+	[[nodiscard]] dv::EventStore filterEvents(const dv::EventStore &events) const {
+		if (!eventRoi.has_value() && eventDecimation <= 1) {
+			return events;
+		}
+
+		auto packet = std::make_shared<dv::EventPacket>();
+		packet->elements.reserve(events.size() / eventDecimation + 1);
+		const cv::Rect roi = eventRoi.value_or(cv::Rect(cv::Point(0, 0), *eventResolution));
+		size_t index       = 0;
+		for (const auto &event : events) {
+			if (!roi.contains(cv::Point(event.x(), event.y())) || index++ % eventDecimation != 0) {
+				continue;
+			}
+			packet->elements.emplace_back(event.timestamp(), static_cast<int16_t>(event.x() - roi.x),
+				static_cast<int16_t>(event.y() - roi.y), event.polarity());
+		}
+		return dv::EventStore(std::const_pointer_cast<const dv::EventPacket>(packet));
+	}
+
+	std::vector<BagMessage> operator()(const dv::Frame &frame) const {
+		const auto msg = dv_ros2_msgs::frameToRosImageMessage(frame);
+		return {serializeMessage(msg, topicNamespace + "/image", msg.header.stamp)};
+	}
+
+	std::vector<BagMessage> operator()(const dv::EventStore &packet) const {
+		const auto events = filterEvents(packet);
+		if (events.isEmpty()) {
+			return {};
+		}
+
+		const cv::Size resolution = eventRoi.has_value() ? eventRoi->size() : *eventResolution;
+		const auto msg            = dv_ros2_msgs::toRosEventsMessage(events, resolution);
+		return {serializeMessage(msg, topicNamespace + "/events", dv_ros2_msgs::toRosTime(events.getLowestTime()))};
+	}
+
+	std::vector<BagMessage> operator()(const dv::cvector<dv::IMU> &imuBatch) const {
+		if (batch) {
+			const auto msg = dv_ros2_msgs::toRosImuArrayMessage(imuBatch);
+			return {serializeMessage(msg, topicNamespace + "/imu_array", msg.header.stamp)};
+		}
+
+		std::vector<BagMessage> messages;
+		messages.reserve(imuBatch.size());
+		for (const auto &imu : imuBatch) {
+			const auto msg = dv_ros2_msgs::toRosImuMessage(imu);
+			messages.push_back(serializeMessage(msg, topicNamespace + "/imu", msg.header.stamp));
+		}
+		return messages;
+	}
+
+	std::vector<BagMessage> operator()(const dv::cvector<dv::Trigger> &triggerBatch) const {
+		if (batch) {
+			const auto msg = dv_ros2_msgs::toRosTriggerArrayMessage(triggerBatch);
+			return {serializeMessage(msg, topicNamespace + "/trigger_array", msg.header.stamp)};
+		}
+
+		std::vector<BagMessage> messages;
+		messages.reserve(triggerBatch.size());
+		for (const auto &trigger : triggerBatch) {
+			const auto msg = dv_ros2_msgs::toRosTriggerMessage(trigger);
+			messages.push_back(serializeMessage(msg, topicNamespace + "/trigger", msg.timestamp));
+		}
+		return messages;
+	}
+};
+
+/**
+ * Total size of the bag, the bag is a directory with one or more split storage files.
+ */
+uintmax_t bagSize(const std::filesystem::path &path) {
+	if (!std::filesystem::is_directory(path)) {
+		return std::filesystem::exists(path) ? std::filesystem::file_size(path) : 0;
+	}
+
+	uintmax_t size = 0;
+	for (const auto &entry : std::filesystem::recursive_directory_iterator(path)) {
+		if (entry.is_regular_file()) {
+			size += entry.file_size();
+		}
+	}
+	return size;
+}
+
+} // namespace
 
 void progressBar(const float progress)
 {
@@ -37,22 +258,121 @@ int main(int argc, char **argv) {
 	std::string topicNamespace = "/recording";
 	bool overwrite             = false;
 	bool verbose               = false;
+	bool batch                 = false;
+	size_t jobs                = std::max(std::thread::hardware_concurrency(), 1U);
+	std::string storageId      = "sqlite3";
+	std::string compression    = "none";
+	uint64_t maxBagSize        = 0;
+	uint64_t maxBagDuration    = 0;
+	uint64_t maxCacheSize      = 100 * 1024 * 1024;
+	double startTime           = 0.0;
+	double endTime             = 0.0;
+	bool noEvents              = false;
+	bool noFrames              = false;
+	bool noImu                 = false;
+	bool noTriggers            = false;
+	size_t eventDecimation     = 1;
+	std::vector<int> roi;
+	int64_t eventSliceDuration = 0;
+	size_t eventSliceCount     = 0;
 	app.add_option("-i,--input", input, "Input aedat4 file")->required()->check(CLI::ExistingFile);
 	app.add_option("-o,--output", output,
 		"Output rosbag file path, if not provided, will create file with same path as input, but with .bag extension");
 	app.add_flag("-n,--namespace", topicNamespace, "Topic namespace");
 	app.add_flag("-f,--force-overwrite", overwrite);
 	app.add_flag("-v,--verbose", verbose);
+	app.add_flag("-b,--batch", batch,
+		"Write each IMU and trigger packet as a single ImuArray / TriggerArray message on the imu_array and "
+		"trigger_array topics, instead of one message per sample");
+	app.add_option("-j,--jobs", jobs, "Number of conversion worker threads, defaults to the number of CPU cores")
+		->check(CLI::PositiveNumber);
+	app.add_option("-s,--storage", storageId, "Rosbag2 storage plugin")
+		->check(CLI::IsMember({"sqlite3", "mcap"}))
+		->capture_default_str();
+	app.add_option("-c,--compression", compression,
+		   "Zstd compression of the bag: none, file (each split storage file is compressed once it is closed) or "
+		   "message (each message is compressed individually)")
+		->check(CLI::IsMember({"none", "file", "message"}))
+		->capture_default_str();
+	app.add_option("--max-bag-size", maxBagSize,
+		"Split the bag once a storage file reaches this size in bytes, 0 disables splitting by size");
+	app.add_option("--max-bag-duration", maxBagDuration,
+		"Split the bag once a storage file spans this duration in seconds, 0 disables splitting by duration");
+	app.add_option("--max-cache-size", maxCacheSize,
+		"Size in bytes of the message cache which is flushed to storage in one batch, 0 writes every message "
+		"directly")
+		->capture_default_str();
+	app.add_option("--start", startTime, "Start of the converted time range, in seconds from the start of the recording")
+		->check(CLI::NonNegativeNumber);
+	const auto endOption = app.add_option("--end", endTime,
+		   "End of the converted time range, in seconds from the start of the recording, defaults to the end of the "
+		   "recording")
+		->check(CLI::NonNegativeNumber);
+	app.add_flag("--no-events", noEvents, "Do not convert the event stream");
+	app.add_flag("--no-frames", noFrames, "Do not convert the frame stream");
+	app.add_flag("--no-imu", noImu, "Do not convert the IMU stream");
+	app.add_flag("--no-triggers", noTriggers, "Do not convert the trigger stream");
+	app.add_option("--event-decimation", eventDecimation, "Keep only every n-th event, reduces the event rate n times")
+		->check(CLI::PositiveNumber)
+		->capture_default_str();
+	app.add_option("--roi", roi,
+		   "Region of interest of the event stream given as x y width height, events outside of it are dropped and "
+		   "the coordinates are shifted to its origin")
+		->expected(4);
+	const auto sliceDurationOption = app.add_option("--event-slice-duration", eventSliceDuration,
+		"Coalesce the events into messages spanning this duration in milliseconds, by default every 10 ms read "
+		"window is written as one message");
+	sliceDurationOption->check(CLI::PositiveNumber);
+	app.add_option("--event-slice-count", eventSliceCount,
+		   "Coalesce the events into messages of this number of events, counted before decimation and ROI filtering")
+		->check(CLI::PositiveNumber)
+		->excludes(sliceDurationOption);
 
 	CLI11_PARSE(app, argc, argv);
 
 	dv::io::MonoCameraRecording reader(input);
 
+	const bool readEvents   = !noEvents && reader.isEventStreamAvailable();
+	const bool readFrames   = !noFrames && reader.isFrameStreamAvailable();
+	const bool readImu      = !noImu && reader.isImuStreamAvailable();
+	const bool readTriggers = !noTriggers && reader.isTriggerStreamAvailable();
+
+	// Time range in recording timestamps, the end is exclusive
+	const auto startEnd      = reader.getTimeRange();
+	const int64_t rangeStart = startEnd.first + static_cast<int64_t>(startTime * 1e6);
+	const int64_t rangeEnd   = endOption->count() > 0
+								 ? std::min(startEnd.first + static_cast<int64_t>(endTime * 1e6), startEnd.second + 1)
+								 : startEnd.second + 1;
+	if (rangeStart >= rangeEnd) {
+		std::cout << "The start of the time range has to be before its end and the end of the recording" << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	std::optional<cv::Rect> eventRoi;
+	if (!roi.empty()) {
+		eventRoi = cv::Rect(roi[0], roi[1], roi[2], roi[3]);
+		const auto resolution = reader.getEventResolution();
+		if (resolution.has_value()
+			&& (eventRoi->area() <= 0 || (*eventRoi & cv::Rect(cv::Point(0, 0), *resolution)) != *eventRoi)) {
+			std::cout << "The region of interest has to be non-empty and within the event resolution "
+					  << resolution->width << "x" << resolution->height << std::endl;
+			return EXIT_FAILURE;
+		}
+	}
+
 	if (output.empty()) {
 		output = fs::path(input).replace_extension(".bag").string();
 	}
 
-	if (fs::exists(output) && !overwrite) {
+	// Rosbag2 refuses to open an existing bag directory, only an existing bag is replaced
+	const bool outputExists = fs::exists(output);
+	if (outputExists && !(fs::is_directory(output) && fs::exists(fs::path(output) / "metadata.yaml"))) {
+		std::cout << "Output path " << output << " exists and is not a rosbag2 bag, refusing to replace it"
+				  << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	if (outputExists && !overwrite) {
 		std::cout << "Output file already exists. Do you want to overwrite? [y/n]" << std::endl;
 		char in;
 		std::cin >> in;
@@ -62,56 +382,196 @@ int main(int argc, char **argv) {
 		}
 	}
 
-	auto bag = std::make_unique<rosbag2_cpp::Writer>();
-    bag->open(output);
+	if (outputExists) {
+		fs::remove_all(output);
+	}
+
+	rosbag2_storage::StorageOptions storageOptions;
+	storageOptions.uri                  = output;
+	storageOptions.storage_id           = storageId;
+	storageOptions.max_bagfile_size     = maxBagSize;
+	storageOptions.max_bagfile_duration = maxBagDuration;
+	storageOptions.max_cache_size       = maxCacheSize;
+
+	rosbag2_cpp::ConverterOptions converterOptions;
+	converterOptions.input_serialization_format  = "cdr";
+	converterOptions.output_serialization_format = "cdr";
 
-	dv::io::DataReadHandler handler;
-	if (reader.isFrameStreamAvailable()) {
+	std::unique_ptr<rosbag2_cpp::Writer> bag;
+	if (compression == "none") {
+		bag = std::make_unique<rosbag2_cpp::Writer>();
 	}
+	else {
+		rosbag2_compression::CompressionOptions compressionOptions;
+		compressionOptions.compression_format  = "zstd";
+		compressionOptions.compression_mode    = compression == "file" ? rosbag2_compression::CompressionMode::FILE
+																	   : rosbag2_compression::CompressionMode::MESSAGE;
+		compressionOptions.compression_threads = static_cast<int32_t>(jobs);
+		bag = std::make_unique<rosbag2_cpp::Writer>(
+			std::make_unique<rosbag2_compression::SequentialCompressionWriter>(compressionOptions));
+	}
+	bag->open(storageOptions, converterOptions);
+
+	MessageConverter converter{topicNamespace, reader.getEventResolution(), batch, eventRoi, eventDecimation};
+
+	// Read -> convert -> write pipeline: the main thread reads packets from the recording, the workers convert and
+	// serialize them concurrently and the writer thread restores the read order before writing into the bag.
+	BlockingQueue<ConversionJob> jobQueue(jobs * 4);
+	BlockingQueue<ConversionResult> resultQueue(jobs * 4);
 
-	handler.mFrameHandler = [&bag, &topicNamespace](const dv::Frame &frame) {
-		auto msg = dv_ros2_msgs::frameToRosImageMessage(frame);
-		bag->write(msg, topicNamespace + "/image", msg.header.stamp);
+	std::mutex errorMutex;
+	std::exception_ptr error;
+	std::atomic<bool> failed = false;
+	const auto setError = [&](std::exception_ptr exception) {
+		std::lock_guard<std::mutex> lock(errorMutex);
+		if (!error) {
+			error = std::move(exception);
+		}
+		failed = true;
+		jobQueue.close();
+		resultQueue.close();
 	};
 
-	if (reader.isEventStreamAvailable()) {
-		cv::Size resolution = reader.getEventResolution().value();
+	std::vector<std::thread> workers;
+	workers.reserve(jobs);
+	for (size_t i = 0; i < jobs; ++i) {
+		workers.emplace_back([&] {
+			try {
+				while (auto job = jobQueue.pop()) {
+					if (!resultQueue.push({job->sequence, std::visit(converter, job->data)})) {
+						return;
+					}
+				}
+			}
+			catch (...) {
+				setError(std::current_exception());
+			}
+		});
+	}
 
-		handler.mEventHandler = [&bag, &topicNamespace, &resolution](const dv::EventStore &events) {
-			if (events.isEmpty()) {
-				return;
+	size_t messageCount = 0;
+	std::thread writer([&] {
+		try {
+			// Results arrive out of order, they are held back until all preceding jobs are written
+			std::map<uint64_t, std::vector<BagMessage>> pending;
+			uint64_t nextSequence = 0;
+			while (auto result = resultQueue.pop()) {
+				pending.emplace(result->sequence, std::move(result->messages));
+				for (auto iter = pending.begin(); iter != pending.end() && iter->first == nextSequence;
+					 iter = pending.erase(iter), ++nextSequence) {
+					for (const auto &message : iter->second) {
+						bag->write(message.data, message.topic, message.type, message.time);
+					}
+					messageCount += iter->second.size();
+				}
 			}
+		}
+		catch (...) {
+			setError(std::current_exception());
+		}
+	});
 
-			auto msg = dv_ros2_msgs::toRosEventsMessage(events, resolution);
-			bag->write(msg, topicNamespace + "/events", dv_ros2_msgs::toRosTime(events.getLowestTime()));
+	uint64_t sequence = 0;
+	const auto enqueue = [&](auto data) {
+		jobQueue.push({sequence++, std::move(data)});
+	};
+
+	// Optional coalescing stage, the events of the read windows are re-sliced into messages of a fixed duration or
+	// event count before they are handed to the workers
+	std::unique_ptr<dv::EventStreamSlicer> slicer;
+	dv::EventStore unslicedEvents;
+	if (eventSliceDuration > 0 || eventSliceCount > 0) {
+		slicer = std::make_unique<dv::EventStreamSlicer>();
+		const auto sliceCallback = [&enqueue, &unslicedEvents](const dv::EventStore &slice) {
+			unslicedEvents = unslicedEvents.slice(slice.size());
+			if (!slice.isEmpty()) {
+				enqueue(slice);
+			}
 		};
+		if (eventSliceDuration > 0) {
+			slicer->doEveryTimeInterval(dv::Duration(eventSliceDuration * 1000LL), sliceCallback);
+		}
+		else {
+			slicer->doEveryNumberOfElements(eventSliceCount, sliceCallback);
+		}
 	}
 
-	handler.mImuHandler = [&bag, &topicNamespace](const dv::cvector<dv::IMU> &imuBatch) {
-		for (const auto &imu : imuBatch) {
-			auto msg = dv_ros2_msgs::toRosImuMessage(imu);
-			bag->write(msg, topicNamespace + "/imu", msg.header.stamp);
-		}
-	};
+	const auto wallStart = std::chrono::steady_clock::now();
+	const auto duration  = static_cast<float>(rangeEnd - rangeStart);
+	try {
+		// The recording is read in time windows looked up in the packet index, so only the packets overlapping the
+		// converted time range are read and decoded
+		for (int64_t windowStart = rangeStart; !failed && windowStart < rangeEnd; windowStart += readWindow) {
+			const int64_t windowEnd = std::min(windowStart + readWindow, rangeEnd);
+			if (readEvents) {
+				if (auto events = reader.getEventsTimeRange(windowStart, windowEnd);
+					events.has_value() && !events->isEmpty()) {
+					if (slicer != nullptr) {
+						unslicedEvents.add(*events);
+						slicer->accept(*events);
+					}
+					else {
+						enqueue(std::move(*events));
+					}
+				}
+			}
+			if (readFrames) {
+				if (auto frames = reader.getFramesTimeRange(windowStart, windowEnd); frames.has_value()) {
+					for (auto &frame : *frames) {
+						enqueue(std::move(frame));
+					}
+				}
+			}
+			if (readImu) {
+				if (auto imu = reader.getImuTimeRange(windowStart, windowEnd); imu.has_value() && !imu->empty()) {
+					enqueue(std::move(*imu));
+				}
+			}
+			if (readTriggers) {
+				if (auto triggers = reader.getTriggersTimeRange(windowStart, windowEnd);
+					triggers.has_value() && !triggers->empty()) {
+					enqueue(std::move(*triggers));
+				}
+			}
 
-	handler.mTriggersHandler = [&bag, &topicNamespace](const dv::cvector<dv::Trigger> &triggerBatch) {
-		for (const auto &trigger : triggerBatch) {
-			auto msg = dv_ros2_msgs::toRosTriggerMessage(trigger);
-			bag->write(msg, topicNamespace + "/trigger", msg.timestamp);
+			if (verbose) {
+				progressBar(static_cast<float>(windowEnd - rangeStart) / duration);
+			}
 		}
-	};
 
-	const auto startEnd = reader.getTimeRange();
-	const auto duration = static_cast<float>(startEnd.second - startEnd.first);
-	while (reader.handleNext(handler)) {
-		const float progress = static_cast<float>((handler.seek - startEnd.first)) / duration;
-		if (verbose) {
-			progressBar(progress);
+		// The slicer holds back the events of the last incomplete slice
+		if (!failed && !unslicedEvents.isEmpty()) {
+			enqueue(unslicedEvents);
 		}
 	}
+	catch (...) {
+		setError(std::current_exception());
+	}
+
+	jobQueue.close();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+	resultQueue.close();
+	writer.join();
 
 	bag->close();
 
+	if (error) {
+		std::rethrow_exception(error);
+	}
+
+	if (verbose) {
+		const double elapsed
+			= std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+		const double recorded = static_cast<double>(rangeEnd - rangeStart) * 1e-6;
+		std::cout << std::endl
+				  << "Converted " << messageCount << " messages in " << elapsed << " s using " << jobs
+				  << " worker threads (" << static_cast<double>(messageCount) / elapsed << " messages/s, "
+				  << recorded / elapsed << "x real time)" << std::endl;
+		std::cout << "Wrote " << static_cast<double>(bagSize(output)) / (1024.0 * 1024.0) << " MiB to " << output
+				  << " (" << storageId << " storage, " << compression << " compression)" << std::endl;
+	}
+
 	return EXIT_SUCCESS;
 }
-
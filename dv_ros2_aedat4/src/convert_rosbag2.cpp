@@ -0,0 +1,335 @@
+#include <dv-processing/io/mono_camera_writer.hpp>
+
+#include <dv_ros2_messaging/messaging.hpp>
+
+#include <CLI/CLI.hpp>
+
+#include <rclcpp/serialization.hpp>
+#include <rosbag2_cpp/reader.hpp>
+#include <rosbag2_storage/storage_filter.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <optional>
+
+namespace {
+
+/**
+ * Streams of a bag written by convert_aedat4, identified by the topic name below the namespace.
+ */
+enum class BagStream { Events, Image, Imu, ImuArray, Trigger, TriggerArray };
+
+const std::map<std::string, std::pair<BagStream, std::string>> bagStreams = {
+	{"/events", {BagStream::Events, "dv_ros2_msgs/msg/EventPacket"}},
+	{"/image", {BagStream::Image, "sensor_msgs/msg/Image"}},
+	{"/imu", {BagStream::Imu, "sensor_msgs/msg/Imu"}},
+	{"/imu_array", {BagStream::ImuArray, "dv_ros2_msgs/msg/ImuArray"}},
+	{"/trigger", {BagStream::Trigger, "dv_ros2_msgs/msg/Trigger"}},
+	{"/trigger_array", {BagStream::TriggerArray, "dv_ros2_msgs/msg/TriggerArray"}},
+};
+
+template<class MessageT>
+MessageT deserializeMessage(const rosbag2_storage::SerializedBagMessage &bagMessage) {
+	static const rclcpp::Serialization<MessageT> serialization;
+
+	const rclcpp::SerializedMessage serialized(*bagMessage.serialized_data);
+	MessageT message;
+	serialization.deserialize_message(&serialized, &message);
+	return message;
+}
+
+/**
+ * Read the first message of a topic to get the resolution of a stream.
+ */
+template<class MessageT>
+std::optional<cv::Size> readResolution(rosbag2_cpp::Reader &reader, const std::string &topic) {
+	rosbag2_storage::StorageFilter filter;
+	filter.topics = {topic};
+	reader.set_filter(filter);
+	std::optional<cv::Size> resolution;
+	if (reader.has_next()) {
+		const auto message = deserializeMessage<MessageT>(*reader.read_next());
+		resolution         = cv::Size(static_cast<int>(message.width), static_cast<int>(message.height));
+	}
+	reader.reset_filter();
+	return resolution;
+}
+
+/**
+ * Timestamps written into the aedat4 file have to increase monotonically per stream, samples recorded out of order
+ * are dropped and counted.
+ */
+struct MonotonicStream {
+	int64_t lastTimestamp = std::numeric_limits<int64_t>::min();
+	size_t dropped        = 0;
+
+	bool accept(const int64_t timestamp) {
+		if (timestamp < lastTimestamp) {
+			dropped++;
+			return false;
+		}
+		lastTimestamp = timestamp;
+		return true;
+	}
+};
+
+} // namespace
+
+void progressBar(const float progress)
+{
+   	int barWidth = 70;
+
+	std::cout << "[";
+	int pos = static_cast<int>(static_cast<float>(barWidth) * progress);
+	for (int i = 0; i < barWidth; ++i) {
+		if (i < pos)
+			std::cout << "=";
+		else if (i == pos)
+			std::cout << ">";
+		else
+			std::cout << " ";
+	}
+	std::cout << "] " << int(progress * 100.0) << " %\r";
+	std::cout.flush();
+}
+
+int main(int argc, char **argv) {
+	namespace fs = std::filesystem;
+
+	CLI::App app{"Rosbag2 to aedat4 converter. Converts the events, image, imu and trigger topics written by "
+				 "convert_aedat4 or recorded from the capture node into a single camera aedat4 recording."};
+
+	std::string input;
+	std::string output;
+	std::string topicNamespace = "/recording";
+	std::string cameraName     = "rosbag2";
+	std::string compression    = "lz4";
+	int64_t packetDuration     = 100;
+	bool overwrite             = false;
+	bool verbose               = false;
+	app.add_option("-i,--input", input, "Input rosbag2 directory")->required()->check(CLI::ExistingDirectory);
+	app.add_option("-o,--output", output,
+		"Output aedat4 file path, if not provided, will create file with same path as input, but with .aedat4 "
+		"extension");
+	app.add_option("-n,--namespace", topicNamespace, "Topic namespace")->capture_default_str();
+	app.add_option("--camera-name", cameraName, "Camera name stored in the aedat4 file")->capture_default_str();
+	app.add_option("-c,--compression", compression, "Packet compression of the aedat4 file")
+		->check(CLI::IsMember({"none", "lz4", "lz4_high", "zstd", "zstd_high"}))
+		->capture_default_str();
+	app.add_option("-p,--packet-duration", packetDuration,
+		   "Events of consecutive messages are re-packed into packets spanning this duration in milliseconds")
+		->check(CLI::PositiveNumber)
+		->capture_default_str();
+	app.add_flag("-f,--force-overwrite", overwrite);
+	app.add_flag("-v,--verbose", verbose);
+
+	CLI11_PARSE(app, argc, argv);
+
+	fs::path inputPath(input);
+	if (!inputPath.has_filename()) {
+		inputPath = inputPath.parent_path();
+	}
+	if (output.empty()) {
+		output = fs::path(inputPath).replace_extension(".aedat4").string();
+	}
+
+	if (fs::exists(output) && !overwrite) {
+		std::cout << "Output file already exists. Do you want to overwrite? [y/n]" << std::endl;
+		char in;
+		std::cin >> in;
+		if (in != 'y') {
+			std::cout << "Exiting due to user input" << std::endl;
+			return EXIT_SUCCESS;
+		}
+	}
+
+	rosbag2_cpp::Reader reader;
+	reader.open(inputPath.string());
+
+	// Select the topics below the namespace that match the types written by convert_aedat4
+	std::map<std::string, BagStream> topics;
+	for (const auto &topic : reader.get_all_topics_and_types()) {
+		if (topic.name.rfind(topicNamespace, 0) != 0) {
+			continue;
+		}
+		const auto stream = bagStreams.find(topic.name.substr(topicNamespace.size()));
+		if (stream == bagStreams.end()) {
+			continue;
+		}
+		if (topic.type != stream->second.second) {
+			std::cout << "Skipping topic " << topic.name << " of unsupported type " << topic.type << std::endl;
+			continue;
+		}
+		topics.emplace(topic.name, stream->second.first);
+	}
+	if (topics.empty()) {
+		std::cout << "No events, image, imu or trigger topics found below the namespace " << topicNamespace
+				  << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	const auto hasStream = [&topics](const BagStream type) {
+		return std::any_of(topics.begin(), topics.end(), [type](const auto &topic) {
+			return topic.second == type;
+		});
+	};
+
+	// The aedat4 stream definitions need the resolutions, which are only known from the messages themselves
+	dv::io::MonoCameraWriter::Config config(cameraName);
+	const std::map<std::string, dv::CompressionType> compressionTypes = {
+		{"none", dv::CompressionType::NONE},
+		{"lz4", dv::CompressionType::LZ4},
+		{"lz4_high", dv::CompressionType::LZ4_HIGH},
+		{"zstd", dv::CompressionType::ZSTD},
+		{"zstd_high", dv::CompressionType::ZSTD_HIGH},
+	};
+	config.compression = compressionTypes.at(compression);
+
+	std::optional<cv::Size> eventResolution;
+	if (hasStream(BagStream::Events)) {
+		eventResolution = readResolution<dv_ros2_msgs::msg::EventPacket>(reader, topicNamespace + "/events");
+		if (eventResolution.has_value()) {
+			config.addEventStream(*eventResolution);
+		}
+	}
+	if (hasStream(BagStream::Image)) {
+		const auto resolution = readResolution<sensor_msgs::msg::Image>(reader, topicNamespace + "/image");
+		if (resolution.has_value()) {
+			config.addFrameStream(*resolution);
+		}
+	}
+	if (hasStream(BagStream::Imu) || hasStream(BagStream::ImuArray)) {
+		config.addImuStream();
+	}
+	if (hasStream(BagStream::Trigger) || hasStream(BagStream::TriggerArray)) {
+		config.addTriggerStream();
+	}
+
+	const auto &metadata = reader.get_metadata();
+	const auto bagStart  = metadata.starting_time.time_since_epoch();
+	const auto bagLength = static_cast<float>(metadata.duration.count());
+	rosbag2_storage::StorageFilter filter;
+	for (const auto &[topic, stream] : topics) {
+		filter.topics.push_back(topic);
+	}
+	reader.set_filter(filter);
+	reader.seek(std::chrono::duration_cast<std::chrono::nanoseconds>(bagStart).count());
+
+	dv::io::MonoCameraWriter writer(output, config);
+
+	// Events of consecutive messages are collected into a large packet, which is compressed far better than the small
+	// packets of a live stream and keeps the number of packets in the file low
+	const int64_t packetSpan = packetDuration * 1000;
+	dv::EventStore eventPacket;
+	const auto flushEvents = [&writer, &eventPacket]() {
+		if (!eventPacket.isEmpty()) {
+			writer.writeEvents(eventPacket);
+			eventPacket = dv::EventStore();
+		}
+	};
+
+	MonotonicStream eventStream;
+	MonotonicStream frameStream;
+	MonotonicStream imuStream;
+	MonotonicStream triggerStream;
+	dv::IMUPacket imuPacket;
+	dv::TriggerPacket triggerPacket;
+	size_t messageCount = 0;
+
+	const auto wallStart = std::chrono::steady_clock::now();
+	while (reader.has_next()) {
+		const auto bagMessage = reader.read_next();
+		messageCount++;
+
+		switch (topics.at(bagMessage->topic_name)) {
+			case BagStream::Events: {
+				if (!eventResolution.has_value()) {
+					break;
+				}
+				const auto events = dv_ros2_msgs::toEventStore(
+					deserializeMessage<dv_ros2_msgs::msg::EventPacket>(*bagMessage));
+				if (events.isEmpty() || !eventStream.accept(events.getLowestTime())) {
+					break;
+				}
+				eventStream.lastTimestamp = events.getHighestTime();
+				eventPacket.add(events);
+				if (eventPacket.getHighestTime() - eventPacket.getLowestTime() >= packetSpan) {
+					flushEvents();
+				}
+				break;
+			}
+			case BagStream::Image: {
+				const auto frame = dv_ros2_msgs::toDvFrame(deserializeMessage<sensor_msgs::msg::Image>(*bagMessage));
+				if (frameStream.accept(frame.timestamp)) {
+					writer.writeFrame(frame);
+				}
+				break;
+			}
+			case BagStream::Imu:
+			case BagStream::ImuArray: {
+				const auto imuBatch = topics.at(bagMessage->topic_name) == BagStream::Imu
+										? dv::cvector<dv::IMU>{dv_ros2_msgs::toDvImu(
+											deserializeMessage<sensor_msgs::msg::Imu>(*bagMessage))}
+										: dv_ros2_msgs::toDvImuBatch(
+											deserializeMessage<dv_ros2_msgs::msg::ImuArray>(*bagMessage));
+				imuPacket.elements.clear();
+				for (const auto &imu : imuBatch) {
+					if (imuStream.accept(imu.timestamp)) {
+						imuPacket.elements.push_back(imu);
+					}
+				}
+				if (!imuPacket.elements.empty()) {
+					writer.writeImuPacket(imuPacket);
+				}
+				break;
+			}
+			case BagStream::Trigger:
+			case BagStream::TriggerArray: {
+				dv::cvector<dv::Trigger> triggers;
+				if (topics.at(bagMessage->topic_name) == BagStream::Trigger) {
+					const auto message = deserializeMessage<dv_ros2_msgs::msg::Trigger>(*bagMessage);
+					triggers.emplace_back(
+						dv_ros2_msgs::toDvTime(message.timestamp), static_cast<dv::TriggerType>(message.type));
+				}
+				else {
+					triggers = dv_ros2_msgs::toDvTriggers(
+						deserializeMessage<dv_ros2_msgs::msg::TriggerArray>(*bagMessage));
+				}
+				triggerPacket.elements.clear();
+				for (const auto &trigger : triggers) {
+					if (triggerStream.accept(trigger.timestamp)) {
+						triggerPacket.elements.push_back(trigger);
+					}
+				}
+				if (!triggerPacket.elements.empty()) {
+					writer.writeTriggerPacket(triggerPacket);
+				}
+				break;
+			}
+		}
+
+		if (verbose && bagLength > 0.0f) {
+			progressBar(static_cast<float>(bagMessage->time_stamp - std::chrono::nanoseconds(bagStart).count())
+						/ bagLength);
+		}
+	}
+	flushEvents();
+
+	const size_t dropped = eventStream.dropped + frameStream.dropped + imuStream.dropped + triggerStream.dropped;
+	if (dropped > 0) {
+		std::cout << std::endl
+				  << "Dropped " << dropped << " messages or samples with timestamps out of order" << std::endl;
+	}
+
+	if (verbose) {
+		const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+		std::cout << std::endl
+				  << "Converted " << messageCount << " messages in " << elapsed << " s ("
+				  << static_cast<double>(messageCount) / elapsed << " messages/s)" << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
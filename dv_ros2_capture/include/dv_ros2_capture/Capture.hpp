@@ -9,8 +9,12 @@
 #include <chrono>
 #include <functional>
 #include <unordered_map>
-#include <boost/thread/recursive_mutex.hpp>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <optional>
+#include <algorithm>
+#include <limits>
 #include <boost/lockfree/spsc_queue.hpp>
 
 // ROS2 Libraries
@@ -33,18 +37,68 @@
 #include "dv_ros2_msgs/msg/event.hpp"
 #include "dv_ros2_msgs/msg/event_array.hpp"
 #include "dv_ros2_msgs/msg/event_packet.hpp"
+#include "dv_ros2_msgs/msg/packed_event_array.hpp"
+#include "dv_ros2_msgs/msg/bounded_event_packet.hpp"
+#include "dv_ros2_msgs/msg/compressed_event_packet.hpp"
 #include "dv_ros2_msgs/msg/trigger.hpp"
 #include "dv_ros2_capture/Reader.hpp"
+#include "dv_ros2_messaging/image_pool.hpp"
 #include "dv_ros2_messaging/messaging.hpp"
 #include "dv_ros2_msgs/srv/synchronize_camera.hpp"
 #include "dv_ros2_msgs/srv/set_imu_info.hpp"
 #include "dv_ros2_msgs/srv/set_imu_biases.hpp"
+#include "dv_ros2_msgs/srv/seek_playback.hpp"
 #include "dv_ros2_msgs/msg/camera_discovery.hpp"
 #include "dv_ros2_msgs/msg/imu_info.hpp"
+#include "dv_ros2_msgs/msg/imu_array.hpp"
+#include "dv_ros2_msgs/msg/trigger_array.hpp"
+#include "dv_ros2_msgs/msg/playback_ack.hpp"
+#include "rosgraph_msgs/msg/clock.hpp"
 
 namespace dv_ros2_capture
 {
     using TimestampQueue = boost::lockfree::spsc_queue<int64_t, boost::lockfree::capacity<1000>>;
+
+    /// @brief Time after which a publisher waiting for live data re-checks whether the node is still running.
+    inline constexpr std::chrono::milliseconds liveQueueTimeout{10};
+
+    /// @brief Shortest wall time between two ticks of the playback clock, the publishers poll at the same rate.
+    inline constexpr std::chrono::microseconds minimumPlaybackTick{100};
+
+    /// @brief Recording time the playback clock may run ahead of the slowest publisher in max playback mode.
+    inline constexpr int64_t maxPlaybackLead = 50'000;
+
+    /// @brief Pacing of recording playback.
+    enum class PlaybackMode
+    {
+        /// @brief Follow the wall clock scaled by the playback rate.
+        Timed,
+        /// @brief Publish as fast as the publishers can convert the data.
+        Max,
+        /// @brief Advance by one time increment only after all data was published and acknowledged by the consumers.
+        Acked
+    };
+
+    /// @brief Parse the name of a playback mode.
+    /// @param name One of timed, max or acked.
+    /// @return Playback mode or `std::nullopt` if the name is unknown.
+    [[nodiscard]] inline std::optional<PlaybackMode> playbackModeFromName(const std::string &name)
+    {
+        if (name == "timed")
+        {
+            return PlaybackMode::Timed;
+        }
+        if (name == "max")
+        {
+            return PlaybackMode::Max;
+        }
+        if (name == "acked")
+        {
+            return PlaybackMode::Acked;
+        }
+        return std::nullopt;
+    }
+
     struct Params
     {
         int64_t timeIncrement = 1000;
@@ -54,13 +108,28 @@ namespace dv_ros2_capture
         bool triggers         = true;
         std::string cameraName;
         std::filesystem::path aedat4FilePath;
+        std::vector<std::string> aedat4FileList;
+        bool rebaseTimestamps = false;
         std::filesystem::path cameraCalibrationFilePath;
         std::string cameraFrameName    = "camera";
         std::string imuFrameName       = "imu";
         bool transformImuToCameraFrame = true;
         bool unbiasedImuData           = true;
+        bool imuBatch                  = true;
+        bool imuPerSample              = true;
+        bool triggerBatch              = true;
+        bool triggerPerSample          = true;
+        std::string eventsCompression  = "zstd";
+        int eventsCompressionLevel     = 1;
         bool noiseFiltering            = false;
         int64_t noiseBATime            = 2000;
+        double playbackRate            = 1.0;
+        std::string playbackMode       = "timed";
+        int playbackAckCount           = 0;
+        int64_t playbackStartOffset    = 0;
+        int64_t playbackEndOffset      = 0;
+        bool playbackLoop              = false;
+        int64_t prefetchWindow         = 200;
 
         std::vector<std::string> syncDeviceList;
         bool waitForSync = false;
@@ -76,7 +145,12 @@ namespace dv_ros2_capture
 
         /// @brief Default constructor
         /// @param t_node_name name of the node
-        Capture(const std::string &t_node_name);
+        /// @param options node options
+        Capture(const std::string &t_node_name, const rclcpp::NodeOptions &options = rclcpp::NodeOptions());
+
+        /// @brief Component constructor, registers the parameter callback and starts the node.
+        /// @param options node options passed by the component container
+        explicit Capture(const rclcpp::NodeOptions &options);
 
         /// @brief Shallow copy constructor
         /// @param source object to copy
@@ -101,16 +175,25 @@ namespace dv_ros2_capture
         rcl_interfaces::msg::SetParametersResult paramsCallback(const std::vector<rclcpp::Parameter> &parameters);
     private:
         rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr m_frame_publisher;
+        dv_ros2_msgs::ImageMessagePool m_image_pool;
         rclcpp::Publisher<sensor_msgs::msg::CameraInfo>::SharedPtr m_camera_info_publisher;
-        rclcpp::Publisher<dv_ros2_msgs::msg::EventPacket>::SharedPtr m_events_publisher;
+        rclcpp::Publisher<dv_ros2_msgs::EventStorePacket>::SharedPtr m_events_publisher;
+        rclcpp::Publisher<dv_ros2_msgs::msg::PackedEventArray>::SharedPtr m_packed_events_publisher;
+        rclcpp::Publisher<dv_ros2_msgs::msg::BoundedEventPacket>::SharedPtr m_bounded_events_publisher;
+        rclcpp::Publisher<dv_ros2_msgs::msg::CompressedEventPacket>::SharedPtr m_compressed_events_publisher;
         rclcpp::Publisher<dv_ros2_msgs::msg::Trigger>::SharedPtr m_trigger_publisher;
+        rclcpp::Publisher<dv_ros2_msgs::msg::TriggerArray>::SharedPtr m_trigger_array_publisher;
         rclcpp::Publisher<sensor_msgs::msg::Imu>::SharedPtr m_imu_publisher;
+        rclcpp::Publisher<dv_ros2_msgs::msg::ImuArray>::SharedPtr m_imu_array_publisher;
         rclcpp::Publisher<dv_ros2_msgs::msg::CameraDiscovery>::SharedPtr m_discovery_publisher;
         rclcpp::Publisher<tf2_msgs::msg::TFMessage>::SharedPtr m_transform_publisher;
+        rclcpp::Publisher<rosgraph_msgs::msg::Clock>::SharedPtr m_playback_clock_publisher;
+        rclcpp::Subscription<dv_ros2_msgs::msg::PlaybackAck>::SharedPtr m_playback_ack_subscriber;
 
         rclcpp::Service<sensor_msgs::srv::SetCameraInfo>::SharedPtr m_set_camera_info_service;
         rclcpp::Service<dv_ros2_msgs::srv::SetImuInfo>::SharedPtr m_set_imu_info_service;
         rclcpp::Service<dv_ros2_msgs::srv::SetImuBiases>::SharedPtr m_set_imu_biases_service;
+        rclcpp::Service<dv_ros2_msgs::srv::SeekPlayback>::SharedPtr m_seek_playback_service;
 
         std::unique_ptr<dv::noise::BackgroundActivityNoiseFilter<>> m_noise_filter = nullptr;
         
@@ -125,12 +208,39 @@ namespace dv_ros2_capture
         TimestampQueue m_trigger_queue;
         std::atomic<bool> m_spin_thread = true;
         std::thread m_clock;
+        bool m_live = false;
         std::thread m_sync_thread;
         std::unique_ptr<std::thread> m_discovery_thread = nullptr;
         std::unique_ptr<std::thread> m_camera_info_thread = nullptr;
-        boost::recursive_mutex m_reader_mutex;
         std::atomic<bool> m_synchronized;
         std::atomic<int64_t> m_current_seek;
+        std::atomic<uint8_t> m_events_compression = dv_ros2_msgs::msg::CompressedEventPacket::COMPRESSION_ZSTD;
+        std::atomic<int> m_events_compression_level = 1;
+
+        /// Playback related
+        PlaybackMode m_playback_mode = PlaybackMode::Timed;
+        std::atomic<double> m_playback_rate = 1.0;
+        /// @brief Latest clock timestamp up to which each publisher published all of its data
+        std::atomic<int64_t> m_frame_progress = 0;
+        std::atomic<int64_t> m_imu_progress = 0;
+        std::atomic<int64_t> m_events_progress = 0;
+        std::atomic<int64_t> m_trigger_progress = 0;
+        /// @brief Latest acknowledged playback clock barrier of each consumer
+        std::map<std::string, int64_t> m_playback_acks;
+        /// @brief Latest published playback clock barrier, acks beyond it are stale acks from before a seek or loop
+        int64_t m_playback_barrier = 0;
+        std::mutex m_playback_acks_mutex;
+        /// @brief Signalled when an ack arrives or the node stops, wakes the clock waiting for acks
+        std::condition_variable m_playback_acks_condition;
+        /// @brief Recording time range selected by the playback offsets
+        int64_t m_playback_start = 0;
+        int64_t m_playback_end = 0;
+        std::atomic<bool> m_playback_loop = false;
+        /// @brief Requested playback position, negative if no seek is pending
+        std::atomic<int64_t> m_seek_target = -1;
+        /// @brief Set while the clock moves the playback, publishers park until it is cleared
+        std::atomic<bool> m_seek_pending = false;
+        std::atomic<int> m_seek_parked = 0;
 
         dv::camera::CalibrationSet m_calibration;
 
@@ -158,11 +268,6 @@ namespace dv_ros2_capture
         /// @brief Populate the info message
         void populateInfoMsg(const dv::camera::CameraGeometry &cameraGeometry);
 
-        /// @brief Convert the imu message frame into the camera frame if the transformation exists.
-        /// @param imu
-        /// @return ROS2 Imu message in camera reference frame
-        [[nodiscard]] inline sensor_msgs::msg::Imu transformImuFrame(sensor_msgs::msg::Imu &&imu);
-
 
         /// @brief Service to set the IMU biases
         /// @param request_header Request header.
@@ -210,6 +315,11 @@ namespace dv_ros2_capture
         /// @return Path to the calibration
         fs::path getCameraCalibrationDirectory(bool createDirectories = true) const;
 
+        /// @brief Recording files to play back, from the aedat4 file list or the aedat4 file path, which can be a
+        ///        directory whose aedat4 files are played in the order of their names.
+        /// @return Paths of the recordings, empty when capturing from a live camera.
+        [[nodiscard]] std::vector<fs::path> getRecordingFiles() const;
+
         /// @brief Update background noise filter.
         /// @param enable Enable or disable the noise filter.
         /// @param backgroundActivityTime Time in milliseconds to consider a pixel as active.
@@ -236,9 +346,12 @@ namespace dv_ros2_capture
         /// @sa Capture::discoverSyncDevices
         void sendSyncCalls(const std::map<std::string, std::string> &serviceNames) const;
 
-        /// @brief rclcpp node variable
+        /// @brief rclcpp node variable, non-owning
         rclcpp::Node::SharedPtr m_node;
 
+        /// @brief Handle of the parameter callback registered by the component constructor
+        rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr m_params_callback_handle;
+
         /// @brief Timer for continous callback
         rclcpp::TimerBase::SharedPtr m_timer;
 
@@ -262,8 +375,85 @@ namespace dv_ros2_capture
         /// @param start Start time of a recording file. (-1 if capturing from camera)
         /// @param end End time of a recording file. (-1 if capturing from camera)
         /// @param timeIncrement Increment of the timestamp at each iteration of the thread. The thread sleeps for.
+        ///        With a live camera the clock only monitors the connection. Recordings are paced according to the
+        ///        playback mode: timed playback follows the wall clock scaled by the playback rate, max and acked
+        ///        playback advance by one time increment as soon as the publishers (and in acked mode the consumers)
+        ///        caught up.
         void clock(int64_t start, int64_t end, int64_t timeIncrement);
 
+        /// @brief Hand a playback clock timestamp to the publishers of all enabled streams.
+        /// @param timestamp Recording time up to which the publishers publish their data.
+        void advancePlayback(int64_t timestamp);
+
+        /// @brief Lowest clock timestamp up to which all enabled publishers published their data.
+        /// @return Playback progress, maximum int64_t value if no stream is enabled.
+        [[nodiscard]] int64_t playbackProgress() const;
+
+        /// @brief Hand a clock timestamp to the publishers and block until all enabled publishers published their data up
+        ///        to it, less the allowed lead. The timestamp is handed again while waiting, because a publisher that
+        ///        got ahead of the reader consumes it without reaching it.
+        /// @param timestamp Clock timestamp to wait for.
+        /// @param lead Recording time the timestamp may stay ahead of the playback progress.
+        /// @return False if the node was stopped while waiting.
+        bool waitForPublishers(int64_t timestamp, int64_t lead = 0);
+
+        /// @brief Publish a playback clock barrier and block until the configured number of consumers acknowledged it.
+        /// @param timestamp Clock timestamp of the barrier.
+        /// @return False if the node was stopped while waiting.
+        bool waitForAcks(int64_t timestamp);
+
+        /// @brief Handle the end of the played back time range: restart from its beginning if looping is enabled,
+        ///        otherwise stop the node unless a seek is pending. A failed read of the recording always stops it.
+        /// @param start Beginning of the played back time range.
+        void endPlayback(int64_t start);
+
+        /// @brief Move the playback to a timestamp. The publishers drop their pending data and park while the reader
+        ///        moves to the timestamp, must be called from the clock thread.
+        /// @param timestamp Recording timestamp at which the playback continues.
+        /// @return False if the node was stopped while waiting for the publishers.
+        bool restartPlayback(int64_t timestamp);
+
+        /// @brief Park a playback publisher while the clock moves the playback.
+        /// @param timestamps Clock timestamp queue of the publisher, emptied before parking.
+        void parkForSeek(TimestampQueue &timestamps);
+
+        /// @brief Service to move the recording playback.
+        /// @param request_header Request header.
+        /// @param req       Seek request.
+        /// @param rsp       Seek response.
+        /// @return true if the service call is successful
+        bool seekPlayback(const std::shared_ptr<rmw_request_id_t> request_header,
+                               const std::shared_ptr<dv_ros2_msgs::srv::SeekPlayback::Request> req,
+                               std::shared_ptr<dv_ros2_msgs::srv::SeekPlayback::Response> rsp);
+
+        /// @brief Store the acknowledgement of a playback consumer.
+        /// @param ack Acknowledgement message.
+        void playbackAckCallback(const dv_ros2_msgs::msg::PlaybackAck::SharedPtr ack);
+
+        /// @brief Log a throttled warning when a stream queue of the reader dropped data since the last report.
+        /// @param stream Name of the stream.
+        /// @param dropped Current drop counter of the stream queue.
+        /// @param reported Drop counter at the last report, updated by the call.
+        void reportDrops(const char *stream, uint64_t dropped, uint64_t &reported) const;
+
+        /// @brief Publish a frame and update the current seek time.
+        /// @param frame Frame to publish.
+        void publishFrame(const dv::Frame &frame);
+
+        /// @brief Publish an IMU batch as a single ImuArray message and optionally per sample, update the current seek
+        ///        time.
+        /// @param imuData IMU batch, timestamps are shifted by the IMU time offset in place.
+        void publishImu(dv::cvector<dv::IMU> &imuData);
+
+        /// @brief Filter and publish an event batch and update the current seek time.
+        /// @param events Event batch.
+        /// @param resolution Event sensor resolution.
+        void publishEvents(const dv::EventStore &events, const cv::Size &resolution);
+
+        /// @brief Publish a trigger batch and update the current seek time.
+        /// @param triggerData Trigger batch.
+        void publishTriggers(const dv::cvector<dv::Trigger> &triggerData);
+
         /// @brief Multi-threaded function to read the frames generated by the event camera.
         void framePublisher();
 
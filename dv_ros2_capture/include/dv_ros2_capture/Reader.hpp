@@ -4,9 +4,348 @@
 #include <dv-processing/io/camera_capture.hpp>
 #include <dv-processing/io/mono_camera_recording.hpp>
 
+#include <dv_ros2_capture/StreamQueue.hpp>
+
 #include <opencv2/core/types.hpp>
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 namespace dv_ros2_capture {
+/**
+ * Recording time covered by a single read of the RecordingCursor.
+ */
+inline constexpr int64_t recordingReadWindow = 10'000;
+
+/**
+ * Selection of the streams read from a recording.
+ */
+struct StreamSelection {
+	bool frames   = false;
+	bool events   = false;
+	bool imu      = false;
+	bool triggers = false;
+};
+
+/**
+ * Data of all selected streams within one read window of a recording.
+ */
+struct RecordingWindow {
+	std::optional<dv::EventStore> events;
+	decltype(std::declval<dv::io::MonoCameraRecording &>().getFramesTimeRange(0, 0)) frames;
+	std::optional<dv::cvector<dv::IMU>> imu;
+	std::optional<dv::cvector<dv::Trigger>> triggers;
+};
+
+/**
+ * Recordings played back one after another as a single recording. The timestamps of each file are shifted by the
+ * offset of its entry, with rebasing every file starts right after the end of the previous one, otherwise the files
+ * keep their timestamps and are ordered by them.
+ */
+class RecordingPlaylist {
+public:
+	/**
+	 * File of the playlist, timestamps are in playlist time.
+	 */
+	struct Entry {
+		std::filesystem::path path;
+		int64_t start  = 0;
+		int64_t end    = 0;
+		int64_t offset = 0;
+	};
+
+	/**
+	 * Read the time ranges of the files, the headers are read in parallel.
+	 * @param first 	Already opened recording of the first file.
+	 * @param files 	Recording files, the first one is the file of the opened recording.
+	 * @param cameraName 	Name of the camera to read from the recordings.
+	 * @param rebase 	Rebase the timestamps of each file to continue right after the previous one.
+	 * @throws dv::exceptions::RuntimeError if a file does not match the resolutions of the first one, or if the time
+	 * ranges of the files overlap without rebasing.
+	 */
+	RecordingPlaylist(const dv::io::MonoCameraRecording &first, const std::vector<std::filesystem::path> &files,
+		std::string cameraName, bool rebase);
+
+	/**
+	 * Files of the playlist, ordered by their time range.
+	 * @return 		Playlist entries.
+	 */
+	[[nodiscard]] const std::vector<Entry> &getEntries() const;
+
+	/**
+	 * Name of the camera read from the recordings.
+	 * @return 		Camera name, can be an empty string.
+	 */
+	[[nodiscard]] const std::string &getCameraName() const;
+
+	/**
+	 * Start and end timestamp of the whole playlist.
+	 * @return 		A pair containing start and end timestamps in playlist time.
+	 */
+	[[nodiscard]] std::pair<int64_t, int64_t> getTimeRange() const;
+
+private:
+	std::vector<Entry> mEntries;
+	std::string mCameraName;
+};
+
+/**
+ * Reading access to a RecordingPlaylist for a single thread. Files are opened once a read reaches them, and while a
+ * file is read the next one is opened in the background, so its header and packet index are ready at the transition.
+ */
+class PlaylistReader {
+public:
+	/**
+	 * Construct a reader, no file is opened before the first read.
+	 * @param playlist 	Playlist to read.
+	 */
+	explicit PlaylistReader(std::shared_ptr<const RecordingPlaylist> playlist);
+
+	/**
+	 * Read the selected streams of a window of playlist time, which may span several files.
+	 * @param streams 	Streams to read.
+	 * @param start 	Start timestamp of the window.
+	 * @param end 		Exclusive end timestamp of the window.
+	 * @return 		Window data with timestamps in playlist time.
+	 */
+	[[nodiscard]] RecordingWindow read(const StreamSelection &streams, int64_t start, int64_t end);
+
+private:
+	std::shared_ptr<const RecordingPlaylist> mPlaylist;
+	size_t mOpenEntry = std::numeric_limits<size_t>::max();
+	std::unique_ptr<dv::io::MonoCameraRecording> mRecording;
+	size_t mNextEntry = std::numeric_limits<size_t>::max();
+	std::future<std::unique_ptr<dv::io::MonoCameraRecording>> mNextRecording;
+
+	/**
+	 * Open the file of an entry and start opening the following one.
+	 * @param entry 	Index of the playlist entry.
+	 * @return 		Opened recording.
+	 */
+	dv::io::MonoCameraRecording &open(size_t entry);
+};
+
+/**
+ * Read-ahead stage of one stream of a RecordingCursor. A pool of workers, each with its own handles on the recording
+ * files, reads and decompresses the upcoming windows in parallel into a ring of slots, so the consumer only waits for
+ * the disk when the workers cannot keep up. A slot is reused once the consumer released its window.
+ */
+class WindowPrefetcher {
+public:
+	/**
+	 * Start the workers.
+	 * @param playlist 	Recordings to read.
+	 * @param streams 	Streams to read, a single one as the slots are released per stream.
+	 * @param origin 	Start timestamp of window 0.
+	 * @param end 		Exclusive end timestamp of the last window.
+	 * @param firstWindow 	First window to read.
+	 * @param capacity 	Number of windows held ahead of the consumer.
+	 * @param workers 	Number of worker threads.
+	 */
+	WindowPrefetcher(std::shared_ptr<const RecordingPlaylist> playlist, StreamSelection streams, int64_t origin,
+		int64_t end, int64_t firstWindow, size_t capacity, size_t workers);
+
+	/**
+	 * Stop and join the workers.
+	 */
+	~WindowPrefetcher();
+
+	WindowPrefetcher(const WindowPrefetcher &)            = delete;
+	WindowPrefetcher &operator=(const WindowPrefetcher &) = delete;
+
+	/**
+	 * Wait until a window was read.
+	 * @param window 	Index of the window, must not be released and must be below the window count.
+	 * @return 		Window data, stays valid until the window is released.
+	 * @throws 		The exception a worker caught while reading the window.
+	 */
+	[[nodiscard]] RecordingWindow &acquire(int64_t window);
+
+	/**
+	 * Release all windows below an index, so their slots can be reused.
+	 * @param window 	Lowest window still in use.
+	 */
+	void release(int64_t window);
+
+	/**
+	 * Number of windows that were already read when the consumer acquired them.
+	 * @return 		Hit counter.
+	 */
+	[[nodiscard]] uint64_t hits() const;
+
+	/**
+	 * Number of windows the consumer had to wait for.
+	 * @return 		Miss counter.
+	 */
+	[[nodiscard]] uint64_t misses() const;
+
+private:
+	struct Slot {
+		int64_t window = -1;
+		bool ready     = false;
+		RecordingWindow data;
+		std::exception_ptr error;
+	};
+
+	std::shared_ptr<const RecordingPlaylist> mPlaylist;
+	StreamSelection mStreams;
+	int64_t mOrigin;
+	int64_t mEnd;
+	int64_t mWindowCount;
+	std::vector<Slot> mSlots;
+	std::mutex mMutex;
+	std::condition_variable mReadyCondition;
+	std::condition_variable mSpaceCondition;
+	int64_t mNextWindow;
+	int64_t mReleased;
+	bool mRunning = true;
+	std::atomic<uint64_t> mHits{0};
+	std::atomic<uint64_t> mMisses{0};
+	std::vector<std::thread> mWorkers;
+
+	void work();
+};
+
+/**
+ * Sequential reader of a playlist which can start at any timestamp. Each stream is read in windows of recording
+ * time that the recordings look up in their packet index, so moving the cursor does not scan the files. With a
+ * prefetch window, the windows are read ahead by a WindowPrefetcher.
+ */
+class RecordingCursor {
+public:
+	/**
+	 * Construct a cursor over the whole playlist.
+	 * @param playlist 	Recordings to read.
+	 */
+	explicit RecordingCursor(std::shared_ptr<const RecordingPlaylist> playlist);
+
+	/**
+	 * Configure the read-ahead, takes effect at the next seek or stream selection.
+	 * @param prefetchWindow 	Recording time read ahead of the consumer in microseconds, 0 reads on demand.
+	 */
+	void setPrefetchWindow(int64_t prefetchWindow);
+
+	/**
+	 * Select the streams that are read ahead, restarting the read-ahead at the current position.
+	 * @param streams 	Streams read by the consumer.
+	 */
+	void selectStreams(StreamSelection streams);
+
+	/**
+	 * Move all streams of the cursor.
+	 * @param start 	Timestamp of the first data to read.
+	 * @param end 		Timestamp of the last data to read.
+	 */
+	void seek(int64_t start, int64_t end);
+
+	/**
+	 * Read the next non-empty event batch.
+	 * @return 		Event batch or `std::nullopt` if the cursor reached the end.
+	 */
+	[[nodiscard]] std::optional<dv::EventStore> getNextEventBatch();
+
+	/**
+	 * Read the next non-empty IMU data batch.
+	 * @return 		IMU data batch or `std::nullopt` if the cursor reached the end.
+	 */
+	[[nodiscard]] std::optional<dv::cvector<dv::IMU>> getNextImuBatch();
+
+	/**
+	 * Read the next frame.
+	 * @return 		Frame or `std::nullopt` if the cursor reached the end.
+	 */
+	[[nodiscard]] std::optional<dv::Frame> getNextFrame();
+
+	/**
+	 * Read the next non-empty trigger data batch.
+	 * @return 		Trigger data batch or `std::nullopt` if the cursor reached the end.
+	 */
+	[[nodiscard]] std::optional<dv::cvector<dv::Trigger>> getNextTriggerBatch();
+
+	/**
+	 * Number of windows that were read ahead before the consumer needed them.
+	 * @return 		Hit counter summed over the streams.
+	 */
+	[[nodiscard]] uint64_t prefetchHits() const;
+
+	/**
+	 * Number of windows the consumer had to wait for.
+	 * @return 		Miss counter summed over the streams.
+	 */
+	[[nodiscard]] uint64_t prefetchMisses() const;
+
+private:
+	std::shared_ptr<const RecordingPlaylist> mPlaylist;
+	PlaylistReader mReader;
+	StreamSelection mStreams;
+	int64_t mPrefetchWindow = 0;
+	int64_t mStart          = 0;
+	int64_t mEnd            = 0;
+	int64_t mEventWindow    = 0;
+	int64_t mImuWindow      = 0;
+	int64_t mFrameWindow    = 0;
+	int64_t mTriggerWindow  = 0;
+	std::deque<dv::Frame> mFrames;
+	std::unique_ptr<WindowPrefetcher> mEventPrefetcher;
+	std::unique_ptr<WindowPrefetcher> mImuPrefetcher;
+	std::unique_ptr<WindowPrefetcher> mFramePrefetcher;
+	std::unique_ptr<WindowPrefetcher> mTriggerPrefetcher;
+	uint64_t mPreviousHits   = 0;
+	uint64_t mPreviousMisses = 0;
+
+	/**
+	 * Restart the read-ahead of the selected streams at their current windows.
+	 */
+	void restartPrefetch();
+
+	/**
+	 * Read the windows of a stream until one contains data.
+	 * @param window 	Index of the next window of the stream, advanced past the read windows.
+	 * @param prefetcher 	Read-ahead stage of the stream, nullptr to read on demand.
+	 * @param stream 	Selection of the stream alone, to read a window on demand.
+	 * @param take 		Move the stream data out of a window.
+	 * @param isEmpty 	Check whether the read data is empty.
+	 * @return 		Data of the first non-empty window or `std::nullopt` if the cursor reached the end.
+	 */
+	template<class Take, class IsEmpty>
+	auto readWindows(int64_t &window, WindowPrefetcher *prefetcher, const StreamSelection &stream, Take &&take,
+		IsEmpty &&isEmpty) -> decltype(take(std::declval<RecordingWindow &>()));
+};
+
+/**
+ * Per-stream queues filled by the demultiplexing stage of the Reader.
+ */
+struct Demultiplexer {
+	StreamQueue<dv::Frame> frames{100};
+	StreamQueue<dv::EventStore> events{1000};
+	StreamQueue<dv::cvector<dv::IMU>> imu{1000};
+	StreamQueue<dv::cvector<dv::Trigger>> triggers{1000};
+	std::atomic<bool> running{true};
+	/// Set once reading failed, the thread then closed all queues and ended
+	std::atomic<bool> failed{false};
+	std::exception_ptr error;
+	std::thread thread;
+	bool readFrames   = false;
+	bool readEvents   = false;
+	bool readImu      = false;
+	bool readTriggers = false;
+
+	~Demultiplexer() {
+		running = false;
+		if (thread.joinable()) {
+			thread.join();
+		}
+	}
+};
+
 /**
  * Wrap the dv::io::CameraCapture and the dv::io::MonoCameraRecording in a single interface.
  */
@@ -21,6 +360,16 @@ public:
 	 */
 	explicit Reader(const std::filesystem::path &aedat4FilePath, const std::string &cameraName);
 
+	/**
+	 * Construct a reader playing back several recordings one after another. Stream information, resolutions and the
+	 * getNext* methods refer to the first file, the time range and the demultiplexing stage cover all files.
+	 * @param aedat4FilePaths paths to the recording aedat4 files.
+	 * @param cameraName name of the camera to stram. Can be an empty string.
+	 * @param rebaseTimestamps shift the timestamps of each file to continue right after the previous file.
+	 */
+	Reader(const std::vector<std::filesystem::path> &aedat4FilePaths, const std::string &cameraName,
+		bool rebaseTimestamps);
+
 	/**
 	 * Construct a dv::io::CameraCapture equivalent.
 	 * @param cameraName name of the camera to stram. Can be an empty string.
@@ -93,9 +442,76 @@ public:
 	 */
 	[[nodiscard]] std::optional<std::pair<int64_t, int64_t>> getTimeRange() const;
 
+	/**
+	 * Start the demultiplexing stage: a single thread reads the enabled streams and fans the data out into
+	 * per-stream lock-free queues, so the stream consumers never contend on the reader. The get*Queue methods
+	 * must not be mixed with direct getNext* calls while the stage runs. With a live camera, data is dropped and
+	 * counted when a queue is full, during playback the stage waits for the consumer instead.
+	 * @param frames 	Demultiplex the frame stream.
+	 * @param events 	Demultiplex the event stream.
+	 * @param imu 		Demultiplex the IMU stream.
+	 * @param triggers 	Demultiplex the trigger stream.
+	 */
+	void startDemultiplexer(bool frames, bool events, bool imu, bool triggers);
+
+	/**
+	 * Stop the demultiplexing thread and release the stream queues.
+	 */
+	void stopDemultiplexer();
+
+	/**
+	 * Move the playback of a recording. A running demultiplexing stage is stopped, its queues are emptied and it
+	 * restarts reading at the new position, so the stream consumers must not access the queues during the call.
+	 * @param start 	Timestamp of the first data to read.
+	 * @param end 		Timestamp of the last data to read.
+	 * @throws dv::exceptions::RuntimeError if the reader captures from a live camera.
+	 */
+	void seek(int64_t start, int64_t end);
+
+	/**
+	 * Set the recording time read ahead of the playback, applies to the streams of the next demultiplexing stage.
+	 * @param prefetchWindow 	Read-ahead in microseconds per stream, 0 reads on demand.
+	 */
+	void setPrefetchWindow(int64_t prefetchWindow);
+
+	/**
+	 * Frame queue of the demultiplexing stage.
+	 * @return 		Frame queue, use depth() and dropped() for its statistics.
+	 */
+	[[nodiscard]] StreamQueue<dv::Frame> &getFrameQueue();
+
+	/**
+	 * Event queue of the demultiplexing stage.
+	 * @return 		Event queue, use depth() and dropped() for its statistics.
+	 */
+	[[nodiscard]] StreamQueue<dv::EventStore> &getEventQueue();
+
+	/**
+	 * IMU queue of the demultiplexing stage.
+	 * @return 		IMU queue, use depth() and dropped() for its statistics.
+	 */
+	[[nodiscard]] StreamQueue<dv::cvector<dv::IMU>> &getImuQueue();
+
+	/**
+	 * Trigger queue of the demultiplexing stage.
+	 * @return 		Trigger queue, use depth() and dropped() for its statistics.
+	 */
+	[[nodiscard]] StreamQueue<dv::cvector<dv::Trigger>> &getTriggerQueue();
+
+	/**
+	 * Check whether data can still be read.
+	 * @return 		False if the camera disconnected or reading the recording failed.
+	 */
 	[[nodiscard]] bool isConnected() const;
+
+	/**
+	 * Error that ended the demultiplexing stage.
+	 * @return 		Exception caught while reading, nullptr if reading did not fail.
+	 */
+	[[nodiscard]] std::exception_ptr getReadError() const;
 	[[nodiscard]] const std::unique_ptr<dv::io::CameraCapture> &getCameraCapturePtr() const;
 	[[nodiscard]] const std::unique_ptr<dv::io::MonoCameraRecording> &getMonoCameraRecordingPtr() const;
+	[[nodiscard]] const std::unique_ptr<RecordingCursor> &getRecordingCursorPtr() const;
 	[[nodiscard]] std::string getCameraName() const;
 
 private:
@@ -103,6 +519,16 @@ private:
 	std::unique_ptr<dv::io::CameraCapture> cameraCapturePtr;
 	bool mCameraCapture = false;
 	std::unique_ptr<dv::io::MonoCameraRecording> monoCameraRecordingPtr;
+	std::shared_ptr<const RecordingPlaylist> mPlaylist;
+	std::unique_ptr<RecordingCursor> mRecordingCursor;
+	std::unique_ptr<Demultiplexer> mDemultiplexer;
+
+	[[nodiscard]] Demultiplexer &getDemultiplexer();
+
+	/**
+	 * Start the thread of the demultiplexing stage with its configured streams.
+	 */
+	void launchDemultiplexer();
 };
 } // namespace dv_ros2_capture
 
@@ -0,0 +1,141 @@
+#pragma once
+
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <semaphore>
+
+namespace dv_ros2_capture {
+/**
+ * Single producer, single consumer queue where the consumer can block until data is available. The data is passed
+ * through a lock-free queue, the semaphore only carries the wake-up signal.
+ */
+template<typename T>
+class StreamQueue {
+public:
+	/**
+	 * Construct the queue.
+	 * @param capacity 	Maximum number of elements held by the queue.
+	 */
+	explicit StreamQueue(const size_t capacity) : mQueue(capacity) {
+	}
+
+	/**
+	 * Push an element into the queue and wake up the consumer. The element is dropped and counted if the queue is
+	 * full.
+	 * @param element 	Element to push.
+	 * @return 		True if the element was pushed, false if it was dropped.
+	 */
+	bool push(const T &element) {
+		if (!mQueue.push(element)) {
+			mDropped.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		mDepth.fetch_add(1, std::memory_order_relaxed);
+		mAvailable.release();
+		return true;
+	}
+
+	/**
+	 * Wait until an element is available and pop it.
+	 * @param element 	Output for the popped element.
+	 * @param timeout 	Maximum time to wait for an element.
+	 * @return 		True if an element was popped, false if the timeout expired.
+	 */
+	template<class Rep, class Period>
+	bool pop(T &element, const std::chrono::duration<Rep, Period> &timeout) {
+		if (!mAvailable.try_acquire_for(timeout)) {
+			return false;
+		}
+		return popAvailable(element);
+	}
+
+	/**
+	 * Pop an element without waiting.
+	 * @param element 	Output for the popped element.
+	 * @return 		True if an element was popped, false if the queue is empty.
+	 */
+	bool tryPop(T &element) {
+		if (!mAvailable.try_acquire()) {
+			return false;
+		}
+		return popAvailable(element);
+	}
+
+	/**
+	 * Check whether the queue is full, only valid when called from the producer thread.
+	 * @return 		True if the next push would drop the element.
+	 */
+	[[nodiscard]] bool full() const {
+		return mQueue.write_available() == 0;
+	}
+
+	/**
+	 * Number of elements currently waiting in the queue.
+	 * @return 		Queue depth.
+	 */
+	[[nodiscard]] size_t depth() const {
+		return mDepth.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Mark the end of the stream, only valid when called from the producer thread after its last push.
+	 */
+	void close() {
+		mClosed.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * Check whether the end of the stream was marked.
+	 * @return 		True if the producer closed the queue.
+	 */
+	[[nodiscard]] bool closed() const {
+		return mClosed.load(std::memory_order_acquire);
+	}
+
+	/**
+	 * Check whether the stream ended and all of its elements were popped, only valid when called from the consumer
+	 * thread.
+	 * @return 		True if no more elements will arrive.
+	 */
+	[[nodiscard]] bool exhausted() const {
+		return mClosed.load(std::memory_order_acquire) && mQueue.read_available() == 0;
+	}
+
+	/**
+	 * Discard all elements and reopen the stream, only valid while neither the producer nor the consumer access the
+	 * queue.
+	 */
+	void reset() {
+		mQueue.reset();
+		while (mAvailable.try_acquire()) {
+		}
+		mDepth.store(0, std::memory_order_relaxed);
+		mClosed.store(false, std::memory_order_release);
+	}
+
+	/**
+	 * Number of elements dropped because the queue was full.
+	 * @return 		Drop counter.
+	 */
+	[[nodiscard]] uint64_t dropped() const {
+		return mDropped.load(std::memory_order_relaxed);
+	}
+
+private:
+	boost::lockfree::spsc_queue<T> mQueue;
+	std::counting_semaphore<> mAvailable{0};
+	std::atomic<size_t> mDepth{0};
+	std::atomic<uint64_t> mDropped{0};
+	std::atomic<bool> mClosed{false};
+
+	bool popAvailable(T &element) {
+		if (!mQueue.pop(element)) {
+			return false;
+		}
+		mDepth.fetch_sub(1, std::memory_order_relaxed);
+		return true;
+	}
+};
+} // namespace dv_ros2_capture
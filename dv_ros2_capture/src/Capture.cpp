@@ -2,8 +2,8 @@
 
 namespace dv_ros2_capture
 {
-    Capture::Capture(const std::string &t_node_name) 
-    : Node(t_node_name), m_node{this}
+    Capture::Capture(const std::string &t_node_name, const rclcpp::NodeOptions &options) 
+    : Node(t_node_name, options), m_node{this, [](rclcpp::Node *) {}}
     {
         m_spin_thread = true;
         RCLCPP_INFO(m_node->get_logger(), "Constructor is initialized");
@@ -18,13 +18,24 @@ namespace dv_ros2_capture
 
         parameterPrinter();
 
-        if (m_params.aedat4FilePath.empty())
+        if (const auto files = getRecordingFiles(); files.empty())
         {
             m_reader = Reader(m_params.cameraName);
         }
         else 
         {
-            m_reader = Reader(m_params.aedat4FilePath, m_params.cameraName);
+            RCLCPP_INFO_STREAM(m_node->get_logger(), "Playing back " << files.size() << " recording file(s).");
+            try
+            {
+                m_reader = Reader(files, m_params.cameraName, m_params.rebaseTimestamps);
+            }
+            catch (const std::exception &e)
+            {
+                RCLCPP_ERROR_STREAM(m_node->get_logger(), "Failed to open the recordings: " << e.what());
+                rclcpp::shutdown();
+                std::exit(EXIT_FAILURE);
+            }
+            m_reader.setPrefetchWindow(m_params.prefetchWindow * 1000);
         }
         startup_time = m_node->now();
 
@@ -59,17 +70,31 @@ namespace dv_ros2_capture
         //}
         if (m_params.events)
         {
-            m_events_publisher = m_node->create_publisher<dv_ros2_msgs::msg::EventPacket>("events", 10);
+            m_events_publisher = m_node->create_publisher<dv_ros2_msgs::EventStorePacket>("events", 10);
+            m_packed_events_publisher = m_node->create_publisher<dv_ros2_msgs::msg::PackedEventArray>("events_packed", 10);
+            m_bounded_events_publisher = m_node->create_publisher<dv_ros2_msgs::msg::BoundedEventPacket>("events_bounded", 10);
+            m_compressed_events_publisher = m_node->create_publisher<dv_ros2_msgs::msg::CompressedEventPacket>("events_compressed", 10);
         }
         if (m_params.triggers)
         {
             m_trigger_publisher = m_node->create_publisher<dv_ros2_msgs::msg::Trigger>("trigger", 10);
+            m_trigger_array_publisher = m_node->create_publisher<dv_ros2_msgs::msg::TriggerArray>("trigger_array", 10);
         }
         if (m_params.imu)
         {
             m_imu_publisher = m_node->create_publisher<sensor_msgs::msg::Imu>("imu", 10);
+            m_imu_array_publisher = m_node->create_publisher<dv_ros2_msgs::msg::ImuArray>("imu_array", 10);
         }
         m_camera_info_publisher = m_node->create_publisher<sensor_msgs::msg::CameraInfo>("camera_info", 10);
+        if (m_reader.getMonoCameraRecordingPtr() != nullptr)
+        {
+            m_seek_playback_service = m_node->create_service<dv_ros2_msgs::srv::SeekPlayback>("seek_playback", std::bind(&Capture::seekPlayback, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
+        }
+        if (m_reader.getMonoCameraRecordingPtr() != nullptr && m_playback_mode == PlaybackMode::Acked)
+        {
+            m_playback_clock_publisher = m_node->create_publisher<rosgraph_msgs::msg::Clock>("playback_clock", 10);
+            m_playback_ack_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::PlaybackAck>("playback_ack", 100, std::bind(&Capture::playbackAckCallback, this, std::placeholders::_1));
+        }
         m_set_imu_biases_service = m_node->create_service<dv_ros2_msgs::srv::SetImuBiases>("set_imu_biases", std::bind(&Capture::setImuBiases, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
         m_set_imu_info_service= m_node->create_service<dv_ros2_msgs::srv::SetImuInfo>("set_imu_info", std::bind(&Capture::setImuInfo, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
         m_set_camera_info_service = m_node->create_service<sensor_msgs::srv::SetCameraInfo>("set_camera_info", std::bind(&Capture::setCameraInfo, this, std::placeholders::_1, std::placeholders::_2, std::placeholders::_3));
@@ -195,17 +220,28 @@ namespace dv_ros2_capture
         RCLCPP_INFO(m_node->get_logger(), "Successfully launched.");
     }
 
+    Capture::Capture(const rclcpp::NodeOptions &options)
+    : Capture("dv_ros2_capture", options)
+    {
+        m_params_callback_handle = add_on_set_parameters_callback(std::bind(&Capture::paramsCallback, this, std::placeholders::_1));
+        startCapture();
+    }
+
     Capture::~Capture()
     {
         RCLCPP_INFO(m_node->get_logger(), "Destructor is initialized");
         stop();
-        rclcpp::shutdown();
     }
 
     void Capture::stop()
     {
         RCLCPP_INFO(m_node->get_logger(), "Stopping the capture node...");
-        m_spin_thread = false;
+        {
+            // Taken so the clock cannot miss the wake-up between checking the flag and waiting for acks
+            std::lock_guard<std::mutex> lock(m_playback_acks_mutex);
+            m_spin_thread = false;
+        }
+        m_playback_acks_condition.notify_all();
         m_clock.join();
         if (m_params.frames)
         {
@@ -227,6 +263,15 @@ namespace dv_ros2_capture
         {
             m_sync_thread.join();
         }
+        if (m_params.frames)
+        {
+            RCLCPP_INFO_STREAM(m_node->get_logger(), "Image message pool: " << m_image_pool.hits() << " hits, " << m_image_pool.misses() << " misses.");
+        }
+        if (const auto &cursor = m_reader.getRecordingCursorPtr())
+        {
+            RCLCPP_INFO_STREAM(m_node->get_logger(), "Playback prefetch: " << cursor->prefetchHits() << " hits, " << cursor->prefetchMisses() << " misses.");
+        }
+        m_reader.stopDemultiplexer();
         if (m_camera_info_thread != nullptr)
         {
             m_camera_info_thread->join();
@@ -256,6 +301,14 @@ namespace dv_ros2_capture
         m_node->declare_parameter("imu_frame_name", m_params.imuFrameName);
         m_node->declare_parameter("transform_imu_to_camera_frame", m_params.transformImuToCameraFrame);
         m_node->declare_parameter("unbiased_imu_data", m_params.unbiasedImuData);
+        m_node->declare_parameter("imu_batch", m_params.imuBatch);
+        m_node->declare_parameter("imu_per_sample", m_params.imuPerSample);
+        m_node->declare_parameter("trigger_batch", m_params.triggerBatch);
+        m_node->declare_parameter("trigger_per_sample", m_params.triggerPerSample);
+        m_node->declare_parameter("events_compression", m_params.eventsCompression);
+        int_range.set__from_value(-7).set__to_value(22).set__step(1);
+        descriptor.integer_range = {int_range};
+        m_node->declare_parameter("events_compression_level", m_params.eventsCompressionLevel, descriptor);
         m_node->declare_parameter("noise_filtering", m_params.noiseFiltering);
         int_range.set__from_value(1).set__to_value(1000000).set__step(1);
         descriptor.integer_range = {int_range};
@@ -266,6 +319,28 @@ namespace dv_ros2_capture
         int_range.set__from_value(0).set__to_value(5).set__step(1);
         descriptor.integer_range = {int_range};
         m_node->declare_parameter("bias_sensitivity", m_params.biasSensitivity, descriptor);
+
+        rcl_interfaces::msg::ParameterDescriptor rate_descriptor;
+        rcl_interfaces::msg::FloatingPointRange float_range;
+        float_range.set__from_value(0.1).set__to_value(50.0);
+        rate_descriptor.floating_point_range = {float_range};
+        m_node->declare_parameter("playback_rate", m_params.playbackRate, rate_descriptor);
+        rcl_interfaces::msg::ParameterDescriptor read_only_descriptor;
+        read_only_descriptor.read_only = true;
+        m_node->declare_parameter("playback_mode", m_params.playbackMode, read_only_descriptor);
+        int_range.set__from_value(0).set__to_value(64).set__step(1);
+        read_only_descriptor.integer_range = {int_range};
+        m_node->declare_parameter("playback_ack_count", m_params.playbackAckCount, read_only_descriptor);
+        read_only_descriptor.integer_range.clear();
+        m_node->declare_parameter("playback_start_offset", m_params.playbackStartOffset, read_only_descriptor);
+        m_node->declare_parameter("playback_end_offset", m_params.playbackEndOffset, read_only_descriptor);
+        m_node->declare_parameter("playback_loop", m_params.playbackLoop);
+        int_range.set__from_value(0).set__to_value(10000).set__step(1);
+        read_only_descriptor.integer_range = {int_range};
+        m_node->declare_parameter("prefetch_window", m_params.prefetchWindow, read_only_descriptor);
+        read_only_descriptor.integer_range.clear();
+        m_node->declare_parameter("aedat4_file_list", m_params.aedat4FileList, read_only_descriptor);
+        m_node->declare_parameter("rebase_timestamps", m_params.rebaseTimestamps, read_only_descriptor);
     }
 
     inline void Capture::parameterPrinter() const
@@ -278,11 +353,23 @@ namespace dv_ros2_capture
         RCLCPP_INFO(m_node->get_logger(), "triggers: %s", m_params.triggers ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "camera_name: %s", m_params.cameraName.c_str());
         RCLCPP_INFO(m_node->get_logger(), "aedat4_file_path: %s", m_params.aedat4FilePath.c_str());
+        RCLCPP_INFO(m_node->get_logger(), "aedat4_file_list: ");
+        for (const auto &file : m_params.aedat4FileList)
+        {
+            RCLCPP_INFO(m_node->get_logger(), "  %s", file.c_str());
+        }
+        RCLCPP_INFO(m_node->get_logger(), "rebase_timestamps: %s", m_params.rebaseTimestamps ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "camera_calibration_file_path: %s", m_params.cameraCalibrationFilePath.c_str());
         RCLCPP_INFO(m_node->get_logger(), "camera_frame_name: %s", m_params.cameraFrameName.c_str());
         RCLCPP_INFO(m_node->get_logger(), "imu_frame_name: %s", m_params.imuFrameName.c_str());
         RCLCPP_INFO(m_node->get_logger(), "transform_imu_to_camera_frame: %s", m_params.transformImuToCameraFrame ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "unbiased_imu_data: %s", m_params.unbiasedImuData ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "imu_batch: %s", m_params.imuBatch ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "imu_per_sample: %s", m_params.imuPerSample ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "trigger_batch: %s", m_params.triggerBatch ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "trigger_per_sample: %s", m_params.triggerPerSample ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "events_compression: %s", m_params.eventsCompression.c_str());
+        RCLCPP_INFO(m_node->get_logger(), "events_compression_level: %d", m_params.eventsCompressionLevel);
         RCLCPP_INFO(m_node->get_logger(), "noise_filtering: %s", m_params.noiseFiltering ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "noise_ba_time: %d", static_cast<int>(m_params.noiseBATime));
         RCLCPP_INFO(m_node->get_logger(), "sync_device_list: ");
@@ -293,6 +380,13 @@ namespace dv_ros2_capture
         RCLCPP_INFO(m_node->get_logger(), "wait_for_sync: %s", m_params.waitForSync ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "global_hold: %s", m_params.globalHold ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "bias_sensitivity: %d", m_params.biasSensitivity);
+        RCLCPP_INFO(m_node->get_logger(), "playback_rate: %.2f", m_params.playbackRate);
+        RCLCPP_INFO(m_node->get_logger(), "playback_mode: %s", m_params.playbackMode.c_str());
+        RCLCPP_INFO(m_node->get_logger(), "playback_ack_count: %d", m_params.playbackAckCount);
+        RCLCPP_INFO(m_node->get_logger(), "playback_start_offset: %lld", static_cast<long long>(m_params.playbackStartOffset));
+        RCLCPP_INFO(m_node->get_logger(), "playback_end_offset: %lld", static_cast<long long>(m_params.playbackEndOffset));
+        RCLCPP_INFO(m_node->get_logger(), "playback_loop: %s", m_params.playbackLoop ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "prefetch_window: %d", static_cast<int>(m_params.prefetchWindow));
     }
 
     inline bool Capture::readParameters()
@@ -332,6 +426,16 @@ namespace dv_ros2_capture
             RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter aedat4_file_path");
             return false;
         }
+        if (!m_node->get_parameter("aedat4_file_list", m_params.aedat4FileList))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter aedat4_file_list");
+            return false;
+        }
+        if (!m_node->get_parameter("rebase_timestamps", m_params.rebaseTimestamps))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter rebase_timestamps");
+            return false;
+        }
         if (!m_node->get_parameter("camera_calibration_file_path", m_params.cameraCalibrationFilePath))
         {
             RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter camera_calibration_file_path");
@@ -357,6 +461,46 @@ namespace dv_ros2_capture
             RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter unbiased_imu_data");
             return false;
         }
+        if (!m_node->get_parameter("imu_batch", m_params.imuBatch))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter imu_batch");
+            return false;
+        }
+        if (!m_node->get_parameter("imu_per_sample", m_params.imuPerSample))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter imu_per_sample");
+            return false;
+        }
+        if (!m_node->get_parameter("trigger_batch", m_params.triggerBatch))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter trigger_batch");
+            return false;
+        }
+        if (!m_node->get_parameter("trigger_per_sample", m_params.triggerPerSample))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter trigger_per_sample");
+            return false;
+        }
+        if (!m_node->get_parameter("events_compression", m_params.eventsCompression))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter events_compression");
+            return false;
+        }
+        if (const auto compression = dv_ros2_msgs::eventCompressionFromName(m_params.eventsCompression))
+        {
+            m_events_compression = *compression;
+        }
+        else
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Parameter events_compression must be one of none, lz4 or zstd");
+            return false;
+        }
+        if (!m_node->get_parameter("events_compression_level", m_params.eventsCompressionLevel))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter events_compression_level");
+            return false;
+        }
+        m_events_compression_level = m_params.eventsCompressionLevel;
         if (!m_node->get_parameter("noise_filtering", m_params.noiseFiltering))
         {
             RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter noise_filtering");
@@ -387,6 +531,57 @@ namespace dv_ros2_capture
             RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter biasSensitivity");
             return false;
         }
+        if (!m_node->get_parameter("playback_rate", m_params.playbackRate))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter playback_rate");
+            return false;
+        }
+        m_playback_rate = m_params.playbackRate;
+        if (!m_node->get_parameter("playback_mode", m_params.playbackMode))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter playback_mode");
+            return false;
+        }
+        if (const auto mode = playbackModeFromName(m_params.playbackMode))
+        {
+            m_playback_mode = *mode;
+        }
+        else
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Parameter playback_mode must be one of timed, max or acked");
+            return false;
+        }
+        if (!m_node->get_parameter("playback_ack_count", m_params.playbackAckCount))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter playback_ack_count");
+            return false;
+        }
+        if (!m_node->get_parameter("playback_start_offset", m_params.playbackStartOffset))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter playback_start_offset");
+            return false;
+        }
+        if (!m_node->get_parameter("playback_end_offset", m_params.playbackEndOffset))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter playback_end_offset");
+            return false;
+        }
+        if (m_params.playbackStartOffset < 0 || m_params.playbackEndOffset < 0)
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Parameters playback_start_offset and playback_end_offset must not be negative");
+            return false;
+        }
+        if (!m_node->get_parameter("playback_loop", m_params.playbackLoop))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter playback_loop");
+            return false;
+        }
+        m_playback_loop = m_params.playbackLoop;
+        if (!m_node->get_parameter("prefetch_window", m_params.prefetchWindow))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter prefetch_window");
+            return false;
+        }
         return true;
     }
 
@@ -567,6 +762,83 @@ namespace dv_ros2_capture
                     result.reason = "unbiased_imu_data must be a boolean";
                 }
             }
+            else if (param.get_name() == "imu_batch")
+            {
+                if (param.get_type() == rclcpp::ParameterType::PARAMETER_BOOL)
+                {
+                    m_params.imuBatch = param.as_bool();
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "imu_batch must be a boolean";
+                }
+            }
+            else if (param.get_name() == "imu_per_sample")
+            {
+                if (param.get_type() == rclcpp::ParameterType::PARAMETER_BOOL)
+                {
+                    m_params.imuPerSample = param.as_bool();
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "imu_per_sample must be a boolean";
+                }
+            }
+            else if (param.get_name() == "trigger_batch")
+            {
+                if (param.get_type() == rclcpp::ParameterType::PARAMETER_BOOL)
+                {
+                    m_params.triggerBatch = param.as_bool();
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "trigger_batch must be a boolean";
+                }
+            }
+            else if (param.get_name() == "trigger_per_sample")
+            {
+                if (param.get_type() == rclcpp::ParameterType::PARAMETER_BOOL)
+                {
+                    m_params.triggerPerSample = param.as_bool();
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "trigger_per_sample must be a boolean";
+                }
+            }
+            else if (param.get_name() == "events_compression")
+            {
+                const auto compression = param.get_type() == rclcpp::ParameterType::PARAMETER_STRING
+                    ? dv_ros2_msgs::eventCompressionFromName(param.as_string())
+                    : std::nullopt;
+                if (compression.has_value())
+                {
+                    m_params.eventsCompression = param.as_string();
+                    m_events_compression = *compression;
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "events_compression must be one of none, lz4 or zstd";
+                }
+            }
+            else if (param.get_name() == "events_compression_level")
+            {
+                if (param.get_type() == rclcpp::ParameterType::PARAMETER_INTEGER)
+                {
+                    m_params.eventsCompressionLevel = static_cast<int>(param.as_int());
+                    m_events_compression_level = m_params.eventsCompressionLevel;
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "events_compression_level must be an integer";
+                }
+            }
             else if (param.get_name() == "noise_filtering")
             {
                 if (param.get_type() == rclcpp::ParameterType::PARAMETER_BOOL)
@@ -639,6 +911,32 @@ namespace dv_ros2_capture
                     result.reason = "bias_sensitivity must be an integer";
                 }
             }
+            else if (param.get_name() == "playback_rate")
+            {
+                if (param.get_type() == rclcpp::ParameterType::PARAMETER_DOUBLE)
+                {
+                    m_params.playbackRate = param.as_double();
+                    m_playback_rate = m_params.playbackRate;
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "playback_rate must be a double";
+                }
+            }
+            else if (param.get_name() == "playback_loop")
+            {
+                if (param.get_type() == rclcpp::ParameterType::PARAMETER_BOOL)
+                {
+                    m_params.playbackLoop = param.as_bool();
+                    m_playback_loop = m_params.playbackLoop;
+                }
+                else
+                {
+                    result.successful = false;
+                    result.reason = "playback_loop must be a boolean";
+                }
+            }
             else
             {
                 result.successful = false;
@@ -694,35 +992,7 @@ namespace dv_ros2_capture
         m_camera_info_msg.p = {fx, 0, cx, 0, 0, fy, cy, 0, 0, 0, 1.0, 0};
     }
 
-    sensor_msgs::msg::Imu Capture::transformImuFrame(sensor_msgs::msg::Imu &&imu)
-    {
-        if (m_params.unbiasedImuData)
-        {
-            imu.linear_acceleration.x -= m_acc_biases.x();
-            imu.linear_acceleration.y -= m_acc_biases.y();
-            imu.linear_acceleration.z -= m_acc_biases.z();
-
-            imu.angular_velocity.x -= m_gyro_biases.x();
-            imu.angular_velocity.y -= m_gyro_biases.y();
-            imu.angular_velocity.z -= m_gyro_biases.z();
-        }
-        if (m_params.transformImuToCameraFrame)
-        {
-            const Eigen::Vector3<double> resW 
-                = m_imu_to_cam_transform.rotatePoint<Eigen::Vector3<double>>(imu.angular_velocity);
-            imu.angular_velocity.x = resW.x();
-            imu.angular_velocity.y = resW.y();
-            imu.angular_velocity.z = resW.z();
-
-            const Eigen::Vector3<double> resV
-                = m_imu_to_cam_transform.rotatePoint<Eigen::Vector3<double>>(imu.linear_acceleration);
-            imu.linear_acceleration.x = resV.x();
-            imu.linear_acceleration.y = resV.y();
-            imu.linear_acceleration.z = resV.z();
-        }
-        return imu;
-    }
-    
+   
     void Capture::updateCalibrationSet()
     {
         RCLCPP_INFO(m_node->get_logger(), "Updating calibration set...");
@@ -837,10 +1107,31 @@ namespace dv_ros2_capture
         {
             m_synchronized = true;
         }
+        m_live = live_capture != nullptr;
 
         if (times.has_value())
         {
-            m_clock = std::thread(&Capture::clock, this, times->first, times->second, m_params.timeIncrement);
+            // The offsets select a time range of the recording, the reader starts directly at its beginning
+            m_playback_start = std::min(times->first + m_params.playbackStartOffset, times->second);
+            m_playback_end = m_params.playbackEndOffset > 0 ? std::min(times->first + m_params.playbackEndOffset, times->second) : times->second;
+            if (m_playback_end < m_playback_start)
+            {
+                RCLCPP_WARN(m_node->get_logger(), "Parameter playback_end_offset is before playback_start_offset, playing back until the end of the recording.");
+                m_playback_end = times->second;
+            }
+            m_reader.seek(m_playback_start, m_playback_end);
+        }
+
+        // A single reader thread fans the data out into per-stream queues consumed by the publishers
+        m_reader.startDemultiplexer(m_params.frames, m_params.events, m_params.imu, m_params.triggers);
+
+        if (times.has_value())
+        {
+            m_frame_progress = m_playback_start;
+            m_imu_progress = m_playback_start;
+            m_events_progress = m_playback_start;
+            m_trigger_progress = m_playback_start;
+            m_clock = std::thread(&Capture::clock, this, m_playback_start, m_playback_end, m_params.timeIncrement);
         }
         else
         {
@@ -897,48 +1188,305 @@ namespace dv_ros2_capture
     {
         RCLCPP_INFO(m_node->get_logger(), "Spinning clock.");
 
-        double frequency = 1.0 / (static_cast<double>(timeIncrement) * 1e-6);
-        
-        rclcpp::Rate sleepRate(frequency);
         if (start == -1)
         {
-            start = std::numeric_limits<int64_t>::max() - 1;
-            end = std::numeric_limits<int64_t>::max();
-            timeIncrement = 0;
             RCLCPP_INFO_STREAM(m_node->get_logger(), "Reading from camera [" << m_reader.getCameraName() << "]");
+
+            // Live publishers are woken by the arriving data, the clock only watches the connection
+            rclcpp::Rate monitorRate(100.0);
+            while (m_spin_thread)
+            {
+                if (!m_reader.isConnected())
+                {
+                    m_spin_thread = false;
+                }
+                monitorRate.sleep();
+            }
+            return;
         }
 
-        while (m_spin_thread)
+        RCLCPP_INFO_STREAM(m_node->get_logger(), "Playing back the recording in " << m_params.playbackMode << " mode.");
+        int64_t cursor = start;
+
+        if (m_playback_mode == PlaybackMode::Max || m_playback_mode == PlaybackMode::Acked)
         {
-            if (m_synchronized.load(std::memory_order_relaxed))
+            while (m_spin_thread)
             {
-                if (m_params.frames)
+                if (const int64_t target = m_seek_target.exchange(-1); target >= 0)
                 {
-                    m_frame_queue.push(start);
+                    if (!restartPlayback(target))
+                    {
+                        break;
+                    }
+                    cursor = target;
                 }
-                if (m_params.events)
+
+                // Bound the lead over the slowest publisher, so the streams stay interleaved in time
+                const int64_t lead = m_playback_mode == PlaybackMode::Max ? maxPlaybackLead : 0;
+                if (!waitForPublishers(cursor, lead))
                 {
-                    m_events_queue.push(start);
+                    break;
                 }
-                if (m_params.triggers)
+                if (m_playback_mode == PlaybackMode::Acked && !waitForAcks(cursor))
                 {
-                    m_trigger_queue.push(start);
+                    break;
                 }
-                if (m_params.imu)
+
+                if (cursor >= end || !m_reader.isConnected())
                 {
-                    m_imu_queue.push(start);
+                    // Let the publishers finish the recording before looping or stopping the node
+                    waitForPublishers(cursor);
+                    endPlayback(start);
                 }
-                start += timeIncrement;
+                cursor += timeIncrement;
+            }
+            return;
+        }
+
+        // The cursor follows the scaled wall time instead of counting ticks, so late wake-ups do not slow the
+        // playback down and rates far above the tick frequency stay accurate
+        double rate = m_playback_rate.load(std::memory_order_relaxed);
+        auto anchorWallTime = std::chrono::steady_clock::now();
+        int64_t anchorCursor = cursor;
+        auto nextTick = anchorWallTime;
+        while (m_spin_thread)
+        {
+            if (const int64_t target = m_seek_target.exchange(-1); target >= 0)
+            {
+                if (!restartPlayback(target))
+                {
+                    break;
+                }
+                cursor = target;
+                anchorCursor = cursor;
+                anchorWallTime = std::chrono::steady_clock::now();
+                nextTick = anchorWallTime;
+            }
+
+            const auto now = std::chrono::steady_clock::now();
+            if (const double currentRate = m_playback_rate.load(std::memory_order_relaxed);
+                currentRate != rate || !m_synchronized.load(std::memory_order_relaxed))
+            {
+                rate = currentRate;
+                anchorWallTime = now;
+                anchorCursor = cursor;
+            }
+            if (m_synchronized.load(std::memory_order_relaxed))
+            {
+                const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(now - anchorWallTime);
+                cursor = anchorCursor + static_cast<int64_t>(static_cast<double>(elapsed.count()) * rate);
+                advancePlayback(cursor);
+            }
+
+            const auto tick = std::max<std::chrono::microseconds>(
+                std::chrono::microseconds(static_cast<int64_t>(static_cast<double>(timeIncrement) / rate)), minimumPlaybackTick);
+            nextTick = std::max(nextTick + tick, now);
+            std::this_thread::sleep_until(nextTick);
+
+            if (cursor >= end || !m_reader.isConnected())
+            {
+                endPlayback(start);
+            }
+        }
+    }
+
+    void Capture::endPlayback(const int64_t start)
+    {
+        if (const auto error = m_reader.getReadError())
+        {
+            // Looping or seeking would only run into the same broken data again
+            try
+            {
+                std::rethrow_exception(error);
+            }
+            catch (const std::exception &e)
+            {
+                RCLCPP_ERROR_STREAM(m_node->get_logger(), "Stopping the playback, reading the recording failed: " << e.what());
             }
+            catch (...)
+            {
+                RCLCPP_ERROR(m_node->get_logger(), "Stopping the playback, reading the recording failed.");
+            }
+            m_spin_thread = false;
+            return;
+        }
+        if (m_playback_loop.load(std::memory_order_relaxed))
+        {
+            // A pending seek takes precedence over looping
+            int64_t noSeek = -1;
+            m_seek_target.compare_exchange_strong(noSeek, start);
+        }
+        else if (m_seek_target.load() < 0)
+        {
+            m_spin_thread = false;
+        }
+    }
+
+    bool Capture::restartPlayback(const int64_t timestamp)
+    {
+        const int publishers = static_cast<int>(m_params.frames) + static_cast<int>(m_params.events)
+            + static_cast<int>(m_params.triggers) + static_cast<int>(m_params.imu);
+        m_seek_parked = 0;
+        m_seek_pending.store(true, std::memory_order_release);
+        while (m_spin_thread && m_seek_parked.load(std::memory_order_acquire) < publishers)
+        {
+            std::this_thread::sleep_for(minimumPlaybackTick);
+        }
+        if (!m_spin_thread)
+        {
+            return false;
+        }
+
+        m_reader.seek(timestamp, m_playback_end);
+        {
+            // Acks of barriers before the restart lie ahead of the new position after a loop or a backwards seek
+            std::lock_guard<std::mutex> lock(m_playback_acks_mutex);
+            m_playback_acks.clear();
+            m_playback_barrier = timestamp;
+        }
+        m_frame_progress = timestamp;
+        m_imu_progress = timestamp;
+        m_events_progress = timestamp;
+        m_trigger_progress = timestamp;
+        m_seek_pending.store(false, std::memory_order_release);
+        RCLCPP_INFO_STREAM(m_node->get_logger(), "Playback continues at timestamp " << timestamp << ".");
+        return true;
+    }
+
+    void Capture::parkForSeek(TimestampQueue &timestamps)
+    {
+        timestamps.consume_all([](const int64_t) {});
+        m_seek_parked.fetch_add(1, std::memory_order_acq_rel);
+        while (m_spin_thread && m_seek_pending.load(std::memory_order_acquire))
+        {
+            std::this_thread::sleep_for(minimumPlaybackTick);
+        }
+    }
+
+    bool Capture::seekPlayback(const std::shared_ptr<rmw_request_id_t> request_header,
+                               const std::shared_ptr<dv_ros2_msgs::srv::SeekPlayback::Request> req,
+                               std::shared_ptr<dv_ros2_msgs::srv::SeekPlayback::Response> rsp)
+    {
+        (void)request_header;
+        const auto times = m_reader.getTimeRange();
+        if (!times.has_value())
+        {
+            rsp->success = false;
+            rsp->status_message = "Seeking is only supported for recordings.";
+            return false;
+        }
+        const int64_t timestamp = times->first + req->offset;
+        if (req->offset < 0 || timestamp > m_playback_end)
+        {
+            rsp->success = false;
+            rsp->status_message = fmt::format("Offset must be within [0, {}] us.", m_playback_end - times->first);
+            return false;
+        }
 
-            sleepRate.sleep();
+        m_seek_target = timestamp;
+        rsp->success = true;
+        rsp->timestamp = timestamp;
+        rsp->status_message = "Playback seek requested.";
+        return true;
+    }
 
-            if (start >= end || !m_reader.isConnected())
+    void Capture::advancePlayback(const int64_t timestamp)
+    {
+        if (m_params.frames)
+        {
+            m_frame_queue.push(timestamp);
+        }
+        if (m_params.events)
+        {
+            m_events_queue.push(timestamp);
+        }
+        if (m_params.triggers)
+        {
+            m_trigger_queue.push(timestamp);
+        }
+        if (m_params.imu)
+        {
+            m_imu_queue.push(timestamp);
+        }
+    }
+
+    int64_t Capture::playbackProgress() const
+    {
+        int64_t progress = std::numeric_limits<int64_t>::max();
+        if (m_params.frames)
+        {
+            progress = std::min(progress, m_frame_progress.load(std::memory_order_acquire));
+        }
+        if (m_params.events)
+        {
+            progress = std::min(progress, m_events_progress.load(std::memory_order_acquire));
+        }
+        if (m_params.triggers)
+        {
+            progress = std::min(progress, m_trigger_progress.load(std::memory_order_acquire));
+        }
+        if (m_params.imu)
+        {
+            progress = std::min(progress, m_imu_progress.load(std::memory_order_acquire));
+        }
+        return progress;
+    }
+
+    bool Capture::waitForPublishers(const int64_t timestamp, const int64_t lead)
+    {
+        const auto retryPeriod = std::chrono::milliseconds(1);
+        auto nextAdvance = std::chrono::steady_clock::now();
+        while (m_spin_thread && timestamp - playbackProgress() > lead)
+        {
+            if (const auto now = std::chrono::steady_clock::now(); now >= nextAdvance)
             {
-                m_spin_thread = false;
+                advancePlayback(timestamp);
+                nextAdvance = now + retryPeriod;
             }
+            std::this_thread::sleep_for(minimumPlaybackTick);
         }
+        return m_spin_thread;
+    }
+
+    bool Capture::waitForAcks(const int64_t timestamp)
+    {
+        std::unique_lock<std::mutex> lock(m_playback_acks_mutex);
+        m_playback_barrier = timestamp;
+        const auto acknowledged = [this, timestamp]
+        {
+            const auto acks = std::count_if(m_playback_acks.begin(), m_playback_acks.end(), [timestamp](const auto &ack)
+            {
+                return ack.second >= timestamp;
+            });
+            return !m_spin_thread || acks >= m_params.playbackAckCount;
+        };
 
+        rosgraph_msgs::msg::Clock barrier;
+        barrier.clock = dv_ros2_msgs::toRosTime(timestamp);
+        m_playback_clock_publisher->publish(barrier);
+        // The barrier is repeated while waiting, so consumers that subscribe late do not stall the playback
+        const auto repeatPeriod = std::chrono::milliseconds(100);
+        while (!m_playback_acks_condition.wait_for(lock, repeatPeriod, acknowledged))
+        {
+            m_playback_clock_publisher->publish(barrier);
+            RCLCPP_INFO_STREAM_THROTTLE(m_node->get_logger(), *m_node->get_clock(), 5000, "Waiting for " << m_params.playbackAckCount << " playback acknowledgements of timestamp " << timestamp << ".");
+        }
+        return m_spin_thread;
+    }
+
+    void Capture::playbackAckCallback(const dv_ros2_msgs::msg::PlaybackAck::SharedPtr ack)
+    {
+        const int64_t timestamp = dv_ros2_msgs::toDvTime(ack->stamp);
+        {
+            std::lock_guard<std::mutex> lock(m_playback_acks_mutex);
+            if (timestamp > m_playback_barrier)
+            {
+                return;
+            }
+            int64_t &latest = m_playback_acks[ack->consumer];
+            latest = std::max(latest, timestamp);
+        }
+        m_playback_acks_condition.notify_one();
     }
 
     void Capture::runDiscovery(const std::string &syncServiceName)
@@ -1155,6 +1703,40 @@ namespace dv_ros2_capture
         return calibPath;
     }
 
+    std::vector<fs::path> Capture::getRecordingFiles() const
+    {
+        std::vector<fs::path> files;
+        for (const auto &file : m_params.aedat4FileList)
+        {
+            if (!file.empty())
+            {
+                files.emplace_back(file);
+            }
+        }
+        if (!files.empty() || m_params.aedat4FilePath.empty())
+        {
+            return files;
+        }
+
+        if (!fs::is_directory(m_params.aedat4FilePath))
+        {
+            return {m_params.aedat4FilePath};
+        }
+        for (const auto &entry : fs::directory_iterator(m_params.aedat4FilePath))
+        {
+            if (entry.is_regular_file() && entry.path().extension() == ".aedat4")
+            {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+        if (files.empty())
+        {
+            throw dv::exceptions::InvalidArgument<std::string>("No aedat4 files found in the directory!", m_params.aedat4FilePath.string());
+        }
+        return files;
+    }
+
     void Capture::updateNoiseFilter(const bool enable, const int64_t backgroundActivityTime)
     {
         if (enable)
@@ -1299,33 +1881,186 @@ namespace dv_ros2_capture
 
     }
 
+    void Capture::publishFrame(const dv::Frame &frame)
+    {
+        if (m_frame_publisher->get_subscription_count() > 0)
+        {
+            m_image_pool.publish(*m_frame_publisher, frame.image, dv_ros2_msgs::toRosTime(frame.timestamp));
+        }
+
+        m_current_seek = frame.timestamp;
+    }
+
+    void Capture::publishImu(dv::cvector<dv::IMU> &imuData)
+    {
+        const bool batch = m_params.imuBatch && m_imu_array_publisher->get_subscription_count() > 0;
+        const bool perSample = m_params.imuPerSample && m_imu_publisher->get_subscription_count() > 0;
+        if (batch || perSample)
+        {
+            for (auto &imu : imuData)
+            {
+                imu.timestamp += m_imu_time_offset;
+            }
+
+            // Bias removal and rotation into the camera frame are applied to the whole batch at once
+            const Eigen::Vector3f accBiases = m_params.unbiasedImuData ? m_acc_biases : Eigen::Vector3f::Zero();
+            const Eigen::Vector3f gyroBiases = m_params.unbiasedImuData ? m_gyro_biases : Eigen::Vector3f::Zero();
+            const Eigen::Matrix3f rotation = m_params.transformImuToCameraFrame
+                ? Eigen::Matrix3f(m_imu_to_cam_transform.getTransform().block<3, 3>(0, 0))
+                : Eigen::Matrix3f::Identity();
+
+            auto msg = std::make_unique<dv_ros2_msgs::msg::ImuArray>(
+                dv_ros2_msgs::toRosImuArrayMessage(imuData, accBiases, gyroBiases, rotation));
+            msg->header.frame_id = m_params.imuFrameName;
+            if (perSample)
+            {
+                // Per sample topic is kept for compatibility with existing subscribers
+                for (const auto &sample : msg->samples)
+                {
+                    m_imu_publisher->publish(sample);
+                }
+            }
+            if (batch)
+            {
+                m_imu_array_publisher->publish(std::move(msg));
+            }
+        }
+        m_current_seek = imuData.back().timestamp;
+    }
+
+    void Capture::publishEvents(const dv::EventStore &events, const cv::Size &resolution)
+    {
+        dv::EventStore store;
+        if (m_noise_filter != nullptr) 
+        {
+            m_noise_filter->accept(events);
+            store = m_noise_filter->generateEvents();
+        }
+        else 
+        {
+            store = events;
+        }
+
+        if (m_events_publisher->get_subscription_count() > 0) 
+        {
+            // Adapted type, the store is converted into a message only for inter-process subscribers
+            auto msg = std::make_unique<dv_ros2_msgs::EventStorePacket>();
+            msg->events = store;
+            msg->resolution = resolution;
+            m_events_publisher->publish(std::move(msg));
+        }
+        if (m_packed_events_publisher->get_subscription_count() > 0)
+        {
+            auto msg = dv_ros2_msgs::toRosPackedEventsMessage(store, resolution);
+            m_packed_events_publisher->publish(msg);
+        }
+        if (m_bounded_events_publisher->get_subscription_count() > 0)
+        {
+            // Fixed size messages can be loaned from a shared-memory middleware, large batches are split
+            size_t offset = 0;
+            while (offset < store.size())
+            {
+                dv_ros2_msgs::publishLoaned(*m_bounded_events_publisher, [&](dv_ros2_msgs::msg::BoundedEventPacket &msg)
+                {
+                    offset += dv_ros2_msgs::toRosBoundedEventsMessage(store, offset, resolution, msg);
+                });
+            }
+        }
+        if (m_compressed_events_publisher->get_subscription_count() > 0)
+        {
+            auto msg = std::make_unique<dv_ros2_msgs::msg::CompressedEventPacket>(dv_ros2_msgs::toRosCompressedEventsMessage(
+                store, resolution, m_events_compression.load(), m_events_compression_level.load()));
+            m_compressed_events_publisher->publish(std::move(msg));
+        }
+        m_current_seek = events.getHighestTime();
+    }
+
+    void Capture::publishTriggers(const dv::cvector<dv::Trigger> &triggerData)
+    {
+        if (m_params.triggerBatch && m_trigger_array_publisher->get_subscription_count() > 0)
+        {
+            auto msg = std::make_unique<dv_ros2_msgs::msg::TriggerArray>(dv_ros2_msgs::toRosTriggerArrayMessage(triggerData));
+            msg->header.frame_id = m_params.cameraFrameName;
+            m_trigger_array_publisher->publish(std::move(msg));
+        }
+        if (m_params.triggerPerSample && m_trigger_publisher->get_subscription_count() > 0)
+        {
+            for (const auto &trigger : triggerData)
+            {
+                m_trigger_publisher->publish(dv_ros2_msgs::toRosTriggerMessage(trigger));
+            }
+        }
+        m_current_seek = triggerData.back().timestamp;
+    }
+
+    void Capture::reportDrops(const char *stream, const uint64_t dropped, uint64_t &reported) const
+    {
+        if (dropped > reported)
+        {
+            RCLCPP_WARN_STREAM_THROTTLE(m_node->get_logger(), *m_node->get_clock(), 1000, stream << " queue is full, " << dropped << " elements dropped so far.");
+            reported = dropped;
+        }
+    }
+
     void Capture::framePublisher()
     {
         RCLCPP_INFO(m_node->get_logger(), "Spinning frame publisher.");
+
+        auto &queue = m_reader.getFrameQueue();
+
+        if (m_live)
+        {
+            dv::Frame frame;
+            uint64_t reportedDrops = 0;
+            while (m_spin_thread)
+            {
+                if (queue.pop(frame, liveQueueTimeout) && m_synchronized.load(std::memory_order_relaxed))
+                {
+                    publishFrame(frame);
+                }
+                reportDrops("Frame", queue.dropped(), reportedDrops);
+            }
+            return;
+        }
         
         std::optional<dv::Frame> frame = std::nullopt;
 
         while (m_spin_thread)
         {
+            if (m_seek_pending.load(std::memory_order_acquire))
+            {
+                // Data read before the seek is dropped
+                frame = std::nullopt;
+                parkForSeek(m_frame_queue);
+                continue;
+            }
             m_frame_queue.consume_all([&](const int64_t timestamp)
             {
-                if (!frame.has_value())
+                // Caught up once the next data lies beyond the timestamp or the recording has no more data
+                bool caughtUp = false;
+                while (true)
                 {
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    frame = m_reader.getNextFrame();
-                }
-                while (frame.has_value() && timestamp >= frame->timestamp)
-                {
-                    if (m_frame_publisher->get_subscription_count() > 0)
+                    if (!frame.has_value())
                     {
-                        auto msg = dv_ros2_msgs::frameToRosImageMessage(*frame);
-                        m_frame_publisher->publish(msg);
+                        dv::Frame next;
+                        if (!queue.tryPop(next))
+                        {
+                            caughtUp = queue.exhausted();
+                            break;
+                        }
+                        frame = std::move(next);
                     }
-
-                    m_current_seek = frame->timestamp;
-
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    frame = m_reader.getNextFrame();
+                    if (timestamp < frame->timestamp)
+                    {
+                        caughtUp = true;
+                        break;
+                    }
+                    publishFrame(*frame);
+                    frame = std::nullopt;
+                }
+                if (caughtUp)
+                {
+                    m_frame_progress.store(timestamp, std::memory_order_release);
                 }
             });
             std::this_thread::sleep_for(std::chrono::microseconds(100));
@@ -1336,37 +2071,67 @@ namespace dv_ros2_capture
     {
         RCLCPP_INFO(m_node->get_logger(), "Spinning imu publisher.");
 
+        auto &queue = m_reader.getImuQueue();
+
+        if (m_live)
+        {
+            dv::cvector<dv::IMU> imuData;
+            uint64_t reportedDrops = 0;
+            while (m_spin_thread)
+            {
+                if (queue.pop(imuData, liveQueueTimeout) && !imuData.empty() && m_synchronized.load(std::memory_order_relaxed))
+                {
+                    publishImu(imuData);
+                }
+                reportDrops("IMU", queue.dropped(), reportedDrops);
+            }
+            return;
+        }
+
         std::optional<dv::cvector<dv::IMU>> imuData = std::nullopt;
 
         while(m_spin_thread)
         {
+            if (m_seek_pending.load(std::memory_order_acquire))
+            {
+                // Data read before the seek is dropped
+                imuData = std::nullopt;
+                parkForSeek(m_imu_queue);
+                continue;
+            }
             m_imu_queue.consume_all([&](const int64_t timestamp)
             {
-                if (!imuData.has_value())
-                {
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    imuData = m_reader.getNextImuBatch();
-                }
-                while (imuData.has_value() && !imuData->empty() && timestamp >= imuData->back().timestamp)
+                // Caught up once the next data lies beyond the timestamp or the recording has no more data
+                bool caughtUp = false;
+                while (true)
                 {
-                    if (m_imu_publisher->get_subscription_count() > 0)
+                    if (!imuData.has_value())
                     {
-                        for (auto &imu : *imuData)
+                        dv::cvector<dv::IMU> next;
+                        if (!queue.tryPop(next))
                         {
-                            imu.timestamp += m_imu_time_offset;
-                            m_imu_publisher->publish(transformImuFrame(dv_ros2_msgs::toRosImuMessage(imu)));
+                            caughtUp = queue.exhausted();
+                            break;
                         }
+                        imuData = std::move(next);
                     }
-                    m_current_seek = imuData->back().timestamp;
-
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    imuData = m_reader.getNextImuBatch();
+                    // Empty batches carry nothing to publish
+                    if (imuData->empty())
+                    {
+                        imuData = std::nullopt;
+                        continue;
+                    }
+                    if (timestamp < imuData->back().timestamp)
+                    {
+                        caughtUp = true;
+                        break;
+                    }
+                    publishImu(*imuData);
+                    imuData = std::nullopt;
                 }
-
-                // If value present but empty, we don't want to keep it for later spins.
-                if (imuData.has_value() && imuData->empty())
+                if (caughtUp)
                 {
-                    imuData = std::nullopt;
+                    m_imu_progress.store(timestamp, std::memory_order_release);
                 }
             });
             std::this_thread::sleep_for(std::chrono::microseconds(100));
@@ -1376,47 +2141,70 @@ namespace dv_ros2_capture
     void Capture::eventsPublisher()
     {
         RCLCPP_INFO(m_node->get_logger(), "Spinning events publisher.");
-        
-        std::optional<dv::EventStore> events = std::nullopt;
 
         cv::Size resolution = m_reader.getEventResolution().value();
 
-        while (m_spin_thread)
+        auto &queue = m_reader.getEventQueue();
+
+        if (m_live)
         {
-            m_events_queue.consume_all([&](const int64_t timestamp)
+            dv::EventStore events;
+            uint64_t reportedDrops = 0;
+            while (m_spin_thread)
             {
-                if (!events.has_value())
+                if (queue.pop(events, liveQueueTimeout) && !events.isEmpty() && m_synchronized.load(std::memory_order_relaxed))
                 {
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    events = m_reader.getNextEventBatch();
+                    publishEvents(events, resolution);
                 }
-                while (events.has_value() && !events->isEmpty() && timestamp >= events->getHighestTime()) 
+                reportDrops("Event", queue.dropped(), reportedDrops);
+            }
+            return;
+        }
+        
+        std::optional<dv::EventStore> events = std::nullopt;
+
+        while (m_spin_thread)
+        {
+            if (m_seek_pending.load(std::memory_order_acquire))
+            {
+                // Data read before the seek is dropped
+                events = std::nullopt;
+                parkForSeek(m_events_queue);
+                continue;
+            }
+            m_events_queue.consume_all([&](const int64_t timestamp)
+            {
+                // Caught up once the next data lies beyond the timestamp or the recording has no more data
+                bool caughtUp = false;
+                while (true)
                 {
-				    dv::EventStore store;
-                    if (m_noise_filter != nullptr) 
+                    if (!events.has_value())
                     {
-                        m_noise_filter->accept(*events);
-                        store = m_noise_filter->generateEvents();
+                        dv::EventStore next;
+                        if (!queue.tryPop(next))
+                        {
+                            caughtUp = queue.exhausted();
+                            break;
+                        }
+                        events = std::move(next);
                     }
-                    else 
+                    // Empty batches carry nothing to publish
+                    if (events->isEmpty())
                     {
-                        store = *events;
+                        events = std::nullopt;
+                        continue;
                     }
-
-                    if (m_events_publisher->get_subscription_count() > 0) 
+                    if (timestamp < events->getHighestTime())
                     {
-                        auto msg = dv_ros2_msgs::toRosEventsMessage(store, resolution);
-                        m_events_publisher->publish(msg);
+                        caughtUp = true;
+                        break;
                     }
-                    m_current_seek = store.getHighestTime();
-
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    events = m_reader.getNextEventBatch();
+                    publishEvents(*events, resolution);
+                    events = std::nullopt;
                 }
-
-                if (events.has_value() && events->isEmpty()) 
+                if (caughtUp)
                 {
-                    events = std::nullopt;
+                    m_events_progress.store(timestamp, std::memory_order_release);
                 }
             });
             std::this_thread::sleep_for(std::chrono::microseconds(100));
@@ -1427,39 +2215,73 @@ namespace dv_ros2_capture
     {
         RCLCPP_INFO(m_node->get_logger(), "Spinning trigger publisher.");
 
+        auto &queue = m_reader.getTriggerQueue();
+
+        if (m_live)
+        {
+            dv::cvector<dv::Trigger> triggerData;
+            uint64_t reportedDrops = 0;
+            while (m_spin_thread)
+            {
+                if (queue.pop(triggerData, liveQueueTimeout) && !triggerData.empty() && m_synchronized.load(std::memory_order_relaxed))
+                {
+                    publishTriggers(triggerData);
+                }
+                reportDrops("Trigger", queue.dropped(), reportedDrops);
+            }
+            return;
+        }
+
         std::optional<dv::cvector<dv::Trigger>> triggerData = std::nullopt;
 
         while (m_spin_thread)
         {
+            if (m_seek_pending.load(std::memory_order_acquire))
+            {
+                // Data read before the seek is dropped
+                triggerData = std::nullopt;
+                parkForSeek(m_trigger_queue);
+                continue;
+            }
             m_trigger_queue.consume_all([&](const int64_t timestamp)
             {
-                if (!triggerData.has_value())
+                // Caught up once the next data lies beyond the timestamp or the recording has no more data
+                bool caughtUp = false;
+                while (true)
                 {
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    triggerData = m_reader.getNextTriggerBatch();
-                }
-                while (triggerData.has_value() && !triggerData->empty() && timestamp >= triggerData->back().timestamp)
-                {
-                    if (m_trigger_publisher->get_subscription_count() > 0)
+                    if (!triggerData.has_value())
                     {
-                        for (const auto &trigger : *triggerData)
+                        dv::cvector<dv::Trigger> next;
+                        if (!queue.tryPop(next))
                         {
-                            m_trigger_publisher->publish(dv_ros2_msgs::toRosTriggerMessage(trigger));
+                            caughtUp = queue.exhausted();
+                            break;
                         }
+                        triggerData = std::move(next);
                     }
-                    m_current_seek = triggerData->back().timestamp;
-
-                    std::lock_guard<boost::recursive_mutex> lockGuard(m_reader_mutex);
-                    triggerData = m_reader.getNextTriggerBatch();
+                    // Empty batches carry nothing to publish
+                    if (triggerData->empty())
+                    {
+                        triggerData = std::nullopt;
+                        continue;
+                    }
+                    if (timestamp < triggerData->back().timestamp)
+                    {
+                        caughtUp = true;
+                        break;
+                    }
+                    publishTriggers(*triggerData);
+                    triggerData = std::nullopt;
                 }
-
-                // If value present but empty, we don't want to keep it for later spins.
-                if (triggerData.has_value() && triggerData->empty())
+                if (caughtUp)
                 {
-                    triggerData = std::nullopt;
+                    m_trigger_progress.store(timestamp, std::memory_order_release);
                 }
             });
             std::this_thread::sleep_for(std::chrono::microseconds(100));
         }
     }
-}
\ No newline at end of file
+}
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(dv_ros2_capture::Capture)
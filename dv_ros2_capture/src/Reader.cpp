@@ -1,10 +1,535 @@
 #include <dv_ros2_capture/Reader.hpp>
 
+#include <algorithm>
+#include <limits>
+
 namespace dv_ros2_capture
 {
-    Reader::Reader(const std::filesystem::path &aedat4FilePath, const std::string &cameraName) {
-        monoCameraRecordingPtr = std::make_unique<dv::io::MonoCameraRecording>(aedat4FilePath, cameraName);
-        mCameraCapture         = false;
+    namespace
+    {
+        /// Move the next elements of one stream into its queue. Live data is drained completely and dropped when the
+        /// queue is full, playback reads ahead only while there is space in the queue and closes the queue at the end
+        /// of the recording.
+        template<class Queue, class ReadNext>
+        bool fanOut(Queue &queue, ReadNext &&readNext, const bool live) {
+            bool received = false;
+            while (live || !queue.full()) {
+                auto data = readNext();
+                if (!data.has_value()) {
+                    if (!live) {
+                        queue.close();
+                    }
+                    break;
+                }
+                received = true;
+                queue.push(*data);
+            }
+            return received;
+        }
+
+        /// Read the selected streams until the demultiplexer is stopped. Playback ends once every selected stream
+        /// reached the end of the recording and closed its queue, a seek restarts the thread on reopened queues.
+        template<class Input>
+        void demultiplexStreams(Input &input, Demultiplexer &demultiplexer, const bool live, const bool frames,
+            const bool events, const bool imu, const bool triggers) {
+            while (demultiplexer.running.load(std::memory_order_relaxed)) {
+                bool received = false;
+                if (frames && !demultiplexer.frames.closed()) {
+                    received |= fanOut(demultiplexer.frames, [&input] { return input.getNextFrame(); }, live);
+                }
+                if (events && !demultiplexer.events.closed()) {
+                    received |= fanOut(demultiplexer.events, [&input] { return input.getNextEventBatch(); }, live);
+                }
+                if (imu && !demultiplexer.imu.closed()) {
+                    received |= fanOut(demultiplexer.imu, [&input] { return input.getNextImuBatch(); }, live);
+                }
+                if (triggers && !demultiplexer.triggers.closed()) {
+                    received |= fanOut(demultiplexer.triggers, [&input] { return input.getNextTriggerBatch(); }, live);
+                }
+
+                if ((!frames || demultiplexer.frames.closed()) && (!events || demultiplexer.events.closed())
+                    && (!imu || demultiplexer.imu.closed()) && (!triggers || demultiplexer.triggers.closed())) {
+                    // Only playback closes queues, nothing is left to read
+                    return;
+                }
+
+                // Neither input blocks, back off only when nothing could be read
+                if (!received) {
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                }
+            }
+        }
+
+        /// Run the demultiplexing stage, an exception thrown while reading closes all queues and is stored for the
+        /// consumer, so the streams end instead of the exception terminating the process from the reader thread.
+        template<class Input>
+        void demultiplex(Input &input, Demultiplexer &demultiplexer, const bool live, const bool frames,
+            const bool events, const bool imu, const bool triggers) {
+            try {
+                demultiplexStreams(input, demultiplexer, live, frames, events, imu, triggers);
+            }
+            catch (...) {
+                demultiplexer.error = std::current_exception();
+                demultiplexer.frames.close();
+                demultiplexer.events.close();
+                demultiplexer.imu.close();
+                demultiplexer.triggers.close();
+                demultiplexer.failed.store(true, std::memory_order_release);
+            }
+        }
+
+        /// Shift the timestamps of events, which are immutable within an event store.
+        dv::EventStore shiftEvents(const dv::EventStore &events, const int64_t offset) {
+            auto packet = std::make_shared<dv::EventPacket>();
+            packet->elements.reserve(events.size());
+            for (const auto &event : events) {
+                packet->elements.emplace_back(event.timestamp() + offset, event.x(), event.y(), event.polarity());
+            }
+            return dv::EventStore(std::const_pointer_cast<const dv::EventPacket>(packet));
+        }
+
+        /// Shift the timestamps of timestamped elements in place.
+        template<class Container>
+        void shiftTimestamps(Container &elements, const int64_t offset) {
+            for (auto &element : elements) {
+                element.timestamp += offset;
+            }
+        }
+
+        /// Append the data of an optional container to another one.
+        template<class Data>
+        void append(std::optional<Data> &target, std::optional<Data> &&data) {
+            if (!data.has_value()) {
+                return;
+            }
+            if (!target.has_value()) {
+                target = std::move(data);
+            }
+            else {
+                target->insert(target->end(), std::make_move_iterator(data->begin()), std::make_move_iterator(data->end()));
+            }
+        }
+    } // namespace
+
+    RecordingPlaylist::RecordingPlaylist(const dv::io::MonoCameraRecording &first,
+        const std::vector<std::filesystem::path> &files, std::string cameraName, const bool rebase) :
+        mCameraName(std::move(cameraName)) {
+        if (files.empty()) {
+            throw dv::exceptions::RuntimeError("A playlist needs at least one recording.");
+        }
+
+        std::vector<std::future<std::pair<int64_t, int64_t>>> ranges;
+        for (size_t i = 1; i < files.size(); i++) {
+            ranges.push_back(std::async(std::launch::async, [&file = files[i], &first, this] {
+                const dv::io::MonoCameraRecording recording(file, mCameraName);
+                if (recording.getEventResolution() != first.getEventResolution()
+                    || recording.getFrameResolution() != first.getFrameResolution()) {
+                    throw dv::exceptions::RuntimeError(
+                        "Recording [" + file.string() + "] does not match the resolutions of the first recording.");
+                }
+                return recording.getTimeRange();
+            }));
+        }
+
+        const auto [firstStart, firstEnd] = first.getTimeRange();
+        mEntries.push_back(Entry{files.front(), firstStart, firstEnd, 0});
+        for (size_t i = 1; i < files.size(); i++) {
+            const auto [start, end] = ranges[i - 1].get();
+            mEntries.push_back(Entry{files[i], start, end, 0});
+        }
+
+        if (rebase) {
+            for (size_t i = 1; i < mEntries.size(); i++) {
+                auto &entry  = mEntries[i];
+                entry.offset = mEntries[i - 1].end + 1 - entry.start;
+                entry.start += entry.offset;
+                entry.end += entry.offset;
+            }
+        }
+        else {
+            std::stable_sort(mEntries.begin(), mEntries.end(), [](const Entry &a, const Entry &b) {
+                return a.start < b.start;
+            });
+            // Files keeping their timestamps are read one after another, overlapping data could not be interleaved
+            for (size_t i = 1; i < mEntries.size(); i++) {
+                if (mEntries[i].start <= mEntries[i - 1].end) {
+                    throw dv::exceptions::RuntimeError("Recordings [" + mEntries[i - 1].path.string() + "] and ["
+                                                       + mEntries[i].path.string()
+                                                       + "] overlap in time, enable timestamp rebasing to play them "
+                                                         "back one after another.");
+                }
+            }
+        }
+    }
+
+    const std::vector<RecordingPlaylist::Entry> &RecordingPlaylist::getEntries() const {
+        return mEntries;
+    }
+
+    const std::string &RecordingPlaylist::getCameraName() const {
+        return mCameraName;
+    }
+
+    std::pair<int64_t, int64_t> RecordingPlaylist::getTimeRange() const {
+        int64_t end = mEntries.front().end;
+        for (const auto &entry : mEntries) {
+            end = std::max(end, entry.end);
+        }
+        return {mEntries.front().start, end};
+    }
+
+    PlaylistReader::PlaylistReader(std::shared_ptr<const RecordingPlaylist> playlist) : mPlaylist(std::move(playlist)) {
+    }
+
+    dv::io::MonoCameraRecording &PlaylistReader::open(const size_t entry) {
+        if (entry == mOpenEntry) {
+            return *mRecording;
+        }
+
+        const auto &entries = mPlaylist->getEntries();
+        if (entry == mNextEntry && mNextRecording.valid()) {
+            mRecording = mNextRecording.get();
+        }
+        else {
+            mRecording = std::make_unique<dv::io::MonoCameraRecording>(entries[entry].path, mPlaylist->getCameraName());
+        }
+        mOpenEntry = entry;
+
+        if (entry + 1 < entries.size()) {
+            if (mNextRecording.valid()) {
+                // A skipped file is still opened to completion, the future would block in its destructor anyway
+                mNextRecording.wait();
+            }
+            mNextEntry     = entry + 1;
+            mNextRecording = std::async(std::launch::async, [path = entries[entry + 1].path, cameraName = mPlaylist->getCameraName()] {
+                return std::make_unique<dv::io::MonoCameraRecording>(path, cameraName);
+            });
+        }
+        return *mRecording;
+    }
+
+    RecordingWindow PlaylistReader::read(const StreamSelection &streams, const int64_t start, const int64_t end) {
+        RecordingWindow window;
+        const auto &entries = mPlaylist->getEntries();
+        for (size_t i = 0; i < entries.size(); i++) {
+            const auto &entry = entries[i];
+            if (entry.end < start || entry.start >= end) {
+                continue;
+            }
+
+            auto &recording          = open(i);
+            const int64_t localStart = std::max(start, entry.start) - entry.offset;
+            const int64_t localEnd   = std::min(end, entry.end + 1) - entry.offset;
+            if (streams.events) {
+                auto events = recording.getEventsTimeRange(localStart, localEnd);
+                if (events.has_value() && entry.offset != 0) {
+                    events = shiftEvents(*events, entry.offset);
+                }
+                if (!window.events.has_value()) {
+                    window.events = std::move(events);
+                }
+                else if (events.has_value()) {
+                    window.events->add(*events);
+                }
+            }
+            if (streams.frames) {
+                auto frames = recording.getFramesTimeRange(localStart, localEnd);
+                if (frames.has_value()) {
+                    shiftTimestamps(*frames, entry.offset);
+                }
+                append(window.frames, std::move(frames));
+            }
+            if (streams.imu) {
+                auto imu = recording.getImuTimeRange(localStart, localEnd);
+                if (imu.has_value()) {
+                    shiftTimestamps(*imu, entry.offset);
+                }
+                append(window.imu, std::move(imu));
+            }
+            if (streams.triggers) {
+                auto triggers = recording.getTriggersTimeRange(localStart, localEnd);
+                if (triggers.has_value()) {
+                    shiftTimestamps(*triggers, entry.offset);
+                }
+                append(window.triggers, std::move(triggers));
+            }
+        }
+        return window;
+    }
+
+    WindowPrefetcher::WindowPrefetcher(std::shared_ptr<const RecordingPlaylist> playlist, const StreamSelection streams,
+        const int64_t origin, const int64_t end, const int64_t firstWindow, const size_t capacity,
+        const size_t workers) :
+        mPlaylist(std::move(playlist)),
+        mStreams(streams),
+        mOrigin(origin),
+        mEnd(end),
+        mWindowCount((end - origin + recordingReadWindow - 1) / recordingReadWindow),
+        mSlots(std::max<size_t>(capacity, 1)),
+        mNextWindow(firstWindow),
+        mReleased(firstWindow) {
+        for (size_t i = 0; i < std::max<size_t>(workers, 1); i++) {
+            mWorkers.emplace_back(&WindowPrefetcher::work, this);
+        }
+    }
+
+    WindowPrefetcher::~WindowPrefetcher() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mRunning = false;
+        }
+        mSpaceCondition.notify_all();
+        mReadyCondition.notify_all();
+        for (auto &worker : mWorkers) {
+            worker.join();
+        }
+    }
+
+    RecordingWindow &WindowPrefetcher::acquire(const int64_t window) {
+        Slot &slot = mSlots[static_cast<size_t>(window) % mSlots.size()];
+        std::unique_lock<std::mutex> lock(mMutex);
+        const auto isReady = [&slot, window] {
+            return slot.window == window && slot.ready;
+        };
+        if (isReady()) {
+            mHits.fetch_add(1, std::memory_order_relaxed);
+        }
+        else {
+            mMisses.fetch_add(1, std::memory_order_relaxed);
+            mReadyCondition.wait(lock, [this, &isReady] {
+                return isReady() || !mRunning;
+            });
+        }
+        if (slot.error) {
+            std::rethrow_exception(slot.error);
+        }
+        return slot.data;
+    }
+
+    void WindowPrefetcher::release(const int64_t window) {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            if (window <= mReleased) {
+                return;
+            }
+            mReleased = window;
+        }
+        mSpaceCondition.notify_all();
+    }
+
+    uint64_t WindowPrefetcher::hits() const {
+        return mHits.load(std::memory_order_relaxed);
+    }
+
+    uint64_t WindowPrefetcher::misses() const {
+        return mMisses.load(std::memory_order_relaxed);
+    }
+
+    void WindowPrefetcher::work() {
+        // Each worker decompresses through its own file handles, so the reads run in parallel
+        PlaylistReader reader(mPlaylist);
+        const auto capacity = static_cast<int64_t>(mSlots.size());
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        while (true) {
+            mSpaceCondition.wait(lock, [this, capacity] {
+                return !mRunning || (mNextWindow < mWindowCount && mNextWindow < mReleased + capacity);
+            });
+            if (!mRunning) {
+                return;
+            }
+            const int64_t window = mNextWindow++;
+            lock.unlock();
+
+            const int64_t start = mOrigin + window * recordingReadWindow;
+            RecordingWindow data;
+            std::exception_ptr error;
+            try {
+                data = reader.read(mStreams, start, std::min(start + recordingReadWindow, mEnd));
+            }
+            catch (...) {
+                // Handed to the consumer of the window, which rethrows it on its own thread
+                error = std::current_exception();
+            }
+
+            lock.lock();
+            // The slot was released by the consumer before the window could be claimed
+            Slot &slot  = mSlots[static_cast<size_t>(window % capacity)];
+            slot.window = window;
+            slot.data   = std::move(data);
+            slot.error  = error;
+            slot.ready  = true;
+            mReadyCondition.notify_all();
+        }
+    }
+
+    RecordingCursor::RecordingCursor(std::shared_ptr<const RecordingPlaylist> playlist) :
+        mPlaylist(std::move(playlist)),
+        mReader(mPlaylist) {
+        const auto [start, end] = mPlaylist->getTimeRange();
+        seek(start, end);
+    }
+
+    void RecordingCursor::setPrefetchWindow(const int64_t prefetchWindow) {
+        mPrefetchWindow = prefetchWindow;
+    }
+
+    void RecordingCursor::selectStreams(const StreamSelection streams) {
+        mStreams = streams;
+        restartPrefetch();
+    }
+
+    void RecordingCursor::seek(const int64_t start, const int64_t end) {
+        mStart = start;
+        // Time range reads exclude their end
+        mEnd           = end + 1;
+        mEventWindow   = 0;
+        mImuWindow     = 0;
+        mFrameWindow   = 0;
+        mTriggerWindow = 0;
+        mFrames.clear();
+        restartPrefetch();
+    }
+
+    void RecordingCursor::restartPrefetch() {
+        for (auto *prefetcher : {&mEventPrefetcher, &mImuPrefetcher, &mFramePrefetcher, &mTriggerPrefetcher}) {
+            if (*prefetcher != nullptr) {
+                mPreviousHits += (*prefetcher)->hits();
+                mPreviousMisses += (*prefetcher)->misses();
+                prefetcher->reset();
+            }
+        }
+        if (mPrefetchWindow <= 0) {
+            return;
+        }
+
+        // Every stream is released at its own pace, so each gets a separate ring and the event stream most workers
+        const auto capacity = static_cast<size_t>((mPrefetchWindow + recordingReadWindow - 1) / recordingReadWindow);
+        const size_t eventWorkers = std::clamp<size_t>(std::thread::hardware_concurrency() / 2, 1, 4);
+        const auto makePrefetcher = [&](const StreamSelection streams, const int64_t window, const size_t workers) {
+            return std::make_unique<WindowPrefetcher>(
+                mPlaylist, streams, mStart, mEnd, window, std::max(capacity, workers), workers);
+        };
+        if (mStreams.events) {
+            mEventPrefetcher = makePrefetcher(StreamSelection{.events = true}, mEventWindow, eventWorkers);
+        }
+        if (mStreams.imu) {
+            mImuPrefetcher = makePrefetcher(StreamSelection{.imu = true}, mImuWindow, 1);
+        }
+        if (mStreams.frames) {
+            mFramePrefetcher = makePrefetcher(StreamSelection{.frames = true}, mFrameWindow, 1);
+        }
+        if (mStreams.triggers) {
+            mTriggerPrefetcher = makePrefetcher(StreamSelection{.triggers = true}, mTriggerWindow, 1);
+        }
+    }
+
+    template<class Take, class IsEmpty>
+    auto RecordingCursor::readWindows(int64_t &window, WindowPrefetcher *prefetcher, const StreamSelection &stream,
+        Take &&take, IsEmpty &&isEmpty) -> decltype(take(std::declval<RecordingWindow &>())) {
+        while (mStart + window * recordingReadWindow < mEnd) {
+            decltype(take(std::declval<RecordingWindow &>())) data;
+            if (prefetcher != nullptr) {
+                data = take(prefetcher->acquire(window));
+                window++;
+                prefetcher->release(window);
+            }
+            else {
+                const int64_t start = mStart + window * recordingReadWindow;
+                RecordingWindow read = mReader.read(stream, start, std::min(start + recordingReadWindow, mEnd));
+                data                 = take(read);
+                window++;
+            }
+            if (data.has_value() && !isEmpty(*data)) {
+                return data;
+            }
+        }
+        return std::nullopt;
+    }
+
+    std::optional<dv::EventStore> RecordingCursor::getNextEventBatch() {
+        return readWindows(
+            mEventWindow, mEventPrefetcher.get(), StreamSelection{.events = true},
+            [](RecordingWindow &window) {
+                return std::move(window.events);
+            },
+            [](const dv::EventStore &events) {
+                return events.isEmpty();
+            });
+    }
+
+    std::optional<dv::cvector<dv::IMU>> RecordingCursor::getNextImuBatch() {
+        return readWindows(
+            mImuWindow, mImuPrefetcher.get(), StreamSelection{.imu = true},
+            [](RecordingWindow &window) {
+                return std::move(window.imu);
+            },
+            [](const dv::cvector<dv::IMU> &imu) {
+                return imu.empty();
+            });
+    }
+
+    std::optional<dv::Frame> RecordingCursor::getNextFrame() {
+        if (mFrames.empty()) {
+            auto frames = readWindows(
+                mFrameWindow, mFramePrefetcher.get(), StreamSelection{.frames = true},
+                [](RecordingWindow &window) {
+                    return std::move(window.frames);
+                },
+                [](const auto &window) {
+                    return window.empty();
+                });
+            if (!frames.has_value()) {
+                return std::nullopt;
+            }
+            mFrames.insert(mFrames.end(), std::make_move_iterator(frames->begin()), std::make_move_iterator(frames->end()));
+        }
+        dv::Frame frame = std::move(mFrames.front());
+        mFrames.pop_front();
+        return frame;
+    }
+
+    std::optional<dv::cvector<dv::Trigger>> RecordingCursor::getNextTriggerBatch() {
+        return readWindows(
+            mTriggerWindow, mTriggerPrefetcher.get(), StreamSelection{.triggers = true},
+            [](RecordingWindow &window) {
+                return std::move(window.triggers);
+            },
+            [](const dv::cvector<dv::Trigger> &triggers) {
+                return triggers.empty();
+            });
+    }
+
+    uint64_t RecordingCursor::prefetchHits() const {
+        uint64_t hits = mPreviousHits;
+        for (const auto *prefetcher : {&mEventPrefetcher, &mImuPrefetcher, &mFramePrefetcher, &mTriggerPrefetcher}) {
+            hits += *prefetcher != nullptr ? (*prefetcher)->hits() : 0;
+        }
+        return hits;
+    }
+
+    uint64_t RecordingCursor::prefetchMisses() const {
+        uint64_t misses = mPreviousMisses;
+        for (const auto *prefetcher : {&mEventPrefetcher, &mImuPrefetcher, &mFramePrefetcher, &mTriggerPrefetcher}) {
+            misses += *prefetcher != nullptr ? (*prefetcher)->misses() : 0;
+        }
+        return misses;
+    }
+
+    Reader::Reader(const std::filesystem::path &aedat4FilePath, const std::string &cameraName) :
+        Reader(std::vector<std::filesystem::path>{aedat4FilePath}, cameraName, false) {
+    }
+
+    Reader::Reader(const std::vector<std::filesystem::path> &aedat4FilePaths, const std::string &cameraName,
+        const bool rebaseTimestamps) {
+        if (aedat4FilePaths.empty()) {
+            throw dv::exceptions::RuntimeError("No recording file to read.");
+        }
+        monoCameraRecordingPtr = std::make_unique<dv::io::MonoCameraRecording>(aedat4FilePaths.front(), cameraName);
+        mPlaylist              = std::make_shared<const RecordingPlaylist>(
+            *monoCameraRecordingPtr, aedat4FilePaths, cameraName, rebaseTimestamps);
+        mRecordingCursor = std::make_unique<RecordingCursor>(mPlaylist);
+        mCameraCapture   = false;
     }
 
     Reader::Reader(const std::string &cameraName) {
@@ -107,18 +632,117 @@ namespace dv_ros2_capture
             return std::nullopt;
         }
         else {
-            return monoCameraRecordingPtr->getTimeRange();
+            return mPlaylist->getTimeRange();
         }
     }
 
+    void Reader::startDemultiplexer(const bool frames, const bool events, const bool imu, const bool triggers) {
+        stopDemultiplexer();
+        mDemultiplexer               = std::make_unique<Demultiplexer>();
+        mDemultiplexer->readFrames   = frames;
+        mDemultiplexer->readEvents   = events;
+        mDemultiplexer->readImu      = imu;
+        mDemultiplexer->readTriggers = triggers;
+        if (mRecordingCursor != nullptr) {
+            mRecordingCursor->selectStreams(StreamSelection{frames, events, imu, triggers});
+        }
+        launchDemultiplexer();
+    }
+
+    void Reader::launchDemultiplexer() {
+        // The thread only refers to heap objects, so the reader itself stays movable
+        auto &demultiplexer = *mDemultiplexer;
+        demultiplexer.running = true;
+        if (mCameraCapture) {
+            demultiplexer.thread = std::thread([&input = *cameraCapturePtr, &demultiplexer] {
+                demultiplex(input, demultiplexer, true, demultiplexer.readFrames, demultiplexer.readEvents,
+                    demultiplexer.readImu, demultiplexer.readTriggers);
+            });
+        }
+        else {
+            // Playback reads through the cursor, so it can continue from any position of the recording
+            demultiplexer.thread = std::thread([&input = *mRecordingCursor, &demultiplexer] {
+                demultiplex(input, demultiplexer, false, demultiplexer.readFrames, demultiplexer.readEvents,
+                    demultiplexer.readImu, demultiplexer.readTriggers);
+            });
+        }
+    }
+
+    void Reader::stopDemultiplexer() {
+        mDemultiplexer.reset();
+        if (mRecordingCursor != nullptr) {
+            // Stops the read-ahead workers
+            mRecordingCursor->selectStreams(StreamSelection{});
+        }
+    }
+
+    void Reader::setPrefetchWindow(const int64_t prefetchWindow) {
+        if (mRecordingCursor != nullptr) {
+            mRecordingCursor->setPrefetchWindow(prefetchWindow);
+        }
+    }
+
+    void Reader::seek(const int64_t start, const int64_t end) {
+        if (mCameraCapture) {
+            throw dv::exceptions::RuntimeError("Seeking is only supported for recordings.");
+        }
+        if (mDemultiplexer == nullptr) {
+            mRecordingCursor->seek(start, end);
+            return;
+        }
+
+        mDemultiplexer->running = false;
+        if (mDemultiplexer->thread.joinable()) {
+            mDemultiplexer->thread.join();
+        }
+        mDemultiplexer->failed = false;
+        mDemultiplexer->error  = nullptr;
+        mDemultiplexer->frames.reset();
+        mDemultiplexer->events.reset();
+        mDemultiplexer->imu.reset();
+        mDemultiplexer->triggers.reset();
+        mRecordingCursor->seek(start, end);
+        launchDemultiplexer();
+    }
+
+    Demultiplexer &Reader::getDemultiplexer() {
+        if (mDemultiplexer == nullptr) {
+            throw dv::exceptions::RuntimeError("Reader demultiplexer is not running.");
+        }
+        return *mDemultiplexer;
+    }
+
+    StreamQueue<dv::Frame> &Reader::getFrameQueue() {
+        return getDemultiplexer().frames;
+    }
+
+    StreamQueue<dv::EventStore> &Reader::getEventQueue() {
+        return getDemultiplexer().events;
+    }
+
+    StreamQueue<dv::cvector<dv::IMU>> &Reader::getImuQueue() {
+        return getDemultiplexer().imu;
+    }
+
+    StreamQueue<dv::cvector<dv::Trigger>> &Reader::getTriggerQueue() {
+        return getDemultiplexer().triggers;
+    }
+
     bool Reader::isConnected() const {
         if (mCameraCapture) {
             return cameraCapturePtr->isRunning();
         }
         else {
-            return true;
+            return mDemultiplexer == nullptr || !mDemultiplexer->failed.load(std::memory_order_acquire);
         }
     }
+
+    std::exception_ptr Reader::getReadError() const {
+        if (mDemultiplexer == nullptr || !mDemultiplexer->failed.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return mDemultiplexer->error;
+    }
     const std::unique_ptr<dv::io::CameraCapture> &Reader::getCameraCapturePtr() const {
         return cameraCapturePtr;
     }
@@ -127,6 +751,10 @@ namespace dv_ros2_capture
         return monoCameraRecordingPtr;
     }
 
+    const std::unique_ptr<RecordingCursor> &Reader::getRecordingCursorPtr() const {
+        return mRecordingCursor;
+    }
+
     std::string Reader::getCameraName() const {
         if (mCameraCapture) {
             return cameraCapturePtr->getCameraName();
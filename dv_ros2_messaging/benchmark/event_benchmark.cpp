@@ -0,0 +1,243 @@
+#include <dv_ros2_messaging/messaging.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace
+{
+const cv::Size resolution(640, 480);
+
+/// Synthetic event store with uniformly distributed coordinates and polarities at a constant event rate of 16 events
+/// per microsecond.
+dv::EventStore makeEventStore(const size_t size)
+{
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<int16_t> x(0, static_cast<int16_t>(resolution.width - 1));
+	std::uniform_int_distribution<int16_t> y(0, static_cast<int16_t>(resolution.height - 1));
+	std::bernoulli_distribution polarity(0.5);
+
+	auto packet = std::make_shared<dv::EventPacket>();
+	packet->elements.reserve(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		packet->elements.emplace_back(
+			1'700'000'000'000'000 + static_cast<int64_t>(i / 16), x(generator), y(generator), polarity(generator));
+	}
+	return dv::EventStore(std::const_pointer_cast<const dv::EventPacket>(packet));
+}
+
+/// Synthetic event store where consecutive events are close in space and time, as produced by moving edges.
+dv::EventStore makeClusteredEventStore(const size_t size)
+{
+	std::mt19937 generator(42);
+	std::uniform_int_distribution<int> step(-10, 10);
+	std::bernoulli_distribution polarity(0.5);
+	std::bernoulli_distribution tick(0.25);
+
+	auto packet = std::make_shared<dv::EventPacket>();
+	packet->elements.reserve(size);
+	int64_t timestamp = 1'700'000'000'000'000;
+	int x             = resolution.width / 2;
+	int y             = resolution.height / 2;
+	for (size_t i = 0; i < size; ++i)
+	{
+		timestamp += tick(generator) ? 1 : 0;
+		x = (x + step(generator) + resolution.width) % resolution.width;
+		y = (y + step(generator) + resolution.height) % resolution.height;
+		packet->elements.emplace_back(
+			timestamp, static_cast<int16_t>(x), static_cast<int16_t>(y), polarity(generator));
+	}
+	return dv::EventStore(std::const_pointer_cast<const dv::EventPacket>(packet));
+}
+
+void setEventCounters(benchmark::State &state)
+{
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(dv::Event)));
+}
+
+void BM_ToRosEventsMessage(benchmark::State &state)
+{
+	const auto events = makeEventStore(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		auto msg = dv_ros2_msgs::toRosEventsMessage(events, resolution);
+		benchmark::DoNotOptimize(msg);
+	}
+	setEventCounters(state);
+}
+
+void BM_ToEventStore(benchmark::State &state)
+{
+	const auto msg = dv_ros2_msgs::toRosEventsMessage(makeEventStore(static_cast<size_t>(state.range(0))), resolution);
+	for (auto _ : state)
+	{
+		auto events = dv_ros2_msgs::toEventStore(msg);
+		benchmark::DoNotOptimize(events);
+	}
+	setEventCounters(state);
+}
+
+/// Previous decoding loop, reconstructing timestamps per second and cross-checking every event against toDvTime.
+void BM_ToEventStorePerEventCheck(benchmark::State &state)
+{
+	const auto msg = dv_ros2_msgs::toRosEventsMessage(makeEventStore(static_cast<size_t>(state.range(0))), resolution);
+	for (auto _ : state)
+	{
+		uint32_t seconds  = msg.events.front().ts.sec;
+		int64_t timestamp = static_cast<int64_t>(seconds) * 1'000'000;
+		auto eventPacket  = std::make_shared<dv::EventPacket>();
+		eventPacket->elements.reserve(msg.events.size());
+		for (const auto &event : msg.events)
+		{
+			if (event.ts.sec != seconds)
+			{
+				seconds   = event.ts.sec;
+				timestamp = static_cast<int64_t>(seconds) * 1'000'000;
+			}
+			const int64_t eventTimestamp = timestamp + static_cast<int64_t>(event.ts.nanosec / 1000);
+			dv::runtime_assert(eventTimestamp == dv_ros2_msgs::toDvTime(rclcpp::Time(event.ts)),
+				"Timestamp conversion failed!");
+			eventPacket->elements.emplace_back(eventTimestamp, event.x, event.y, event.polarity);
+		}
+		dv::EventStore events(std::const_pointer_cast<const dv::EventPacket>(eventPacket));
+		benchmark::DoNotOptimize(events);
+	}
+	setEventCounters(state);
+}
+
+/// Event layout conversion alone, into preallocated buffers, with the given kernel.
+void BM_EncodeEvents(benchmark::State &state, const dv_ros2_msgs::_detail::EventKernel kernel)
+{
+	const auto events = makeEventStore(static_cast<size_t>(state.range(0)));
+	const dv::Event *input = dv_ros2_msgs::_detail::contiguousEvents(events);
+	std::vector<dv_ros2_msgs::msg::Event> output(events.size());
+	for (auto _ : state)
+	{
+		dv_ros2_msgs::_detail::encodeEvents(input, events.size(), output.data(), kernel);
+		benchmark::DoNotOptimize(output.data());
+	}
+	setEventCounters(state);
+}
+
+void BM_DecodeEvents(benchmark::State &state, const dv_ros2_msgs::_detail::EventKernel kernel)
+{
+	const auto msg = dv_ros2_msgs::toRosEventsMessage(makeEventStore(static_cast<size_t>(state.range(0))), resolution);
+	dv::cvector<dv::Event> output(msg.events.size());
+	for (auto _ : state)
+	{
+		dv_ros2_msgs::_detail::decodeEvents(msg.events.data(), msg.events.size(), output.data(), kernel);
+		benchmark::DoNotOptimize(output.data());
+	}
+	setEventCounters(state);
+}
+
+/// Compressed encoding, reports the wire size relative to EventPacket (13 bytes per event).
+void BM_ToRosCompressedEventsMessage(benchmark::State &state, const uint8_t compression, const int level)
+{
+	const auto events = makeClusteredEventStore(static_cast<size_t>(state.range(0)));
+	size_t wireSize   = 0;
+	for (auto _ : state)
+	{
+		auto msg = dv_ros2_msgs::toRosCompressedEventsMessage(events, resolution, compression, level);
+		wireSize = msg.data.size();
+		benchmark::DoNotOptimize(msg);
+	}
+	setEventCounters(state);
+	state.counters["bytes_per_event"] = static_cast<double>(wireSize) / static_cast<double>(state.range(0));
+	state.counters["ratio"]           = static_cast<double>(state.range(0) * 13) / static_cast<double>(wireSize);
+}
+
+void BM_CompressedToEventStore(benchmark::State &state, const uint8_t compression, const int level)
+{
+	const auto msg = dv_ros2_msgs::toRosCompressedEventsMessage(
+		makeClusteredEventStore(static_cast<size_t>(state.range(0))), resolution, compression, level);
+	for (auto _ : state)
+	{
+		auto events = dv_ros2_msgs::toEventStore(msg);
+		benchmark::DoNotOptimize(events);
+	}
+	setEventCounters(state);
+}
+
+/// Bit-packed encoding, reports the wire size relative to EventPacket (13 bytes per event).
+void BM_ToRosPackedEventsMessage(benchmark::State &state)
+{
+	const auto events = makeEventStore(static_cast<size_t>(state.range(0)));
+	size_t wireSize   = 0;
+	for (auto _ : state)
+	{
+		auto msg = dv_ros2_msgs::toRosPackedEventsMessage(events, resolution);
+		wireSize = (msg.data.size() + msg.time_escapes.size()) * sizeof(uint64_t);
+		benchmark::DoNotOptimize(msg);
+	}
+	setEventCounters(state);
+	state.counters["bytes_per_event"] = static_cast<double>(wireSize) / static_cast<double>(state.range(0));
+	state.counters["ratio"]           = static_cast<double>(state.range(0) * 13) / static_cast<double>(wireSize);
+}
+
+void BM_PackedToEventStore(benchmark::State &state)
+{
+	const auto msg
+		= dv_ros2_msgs::toRosPackedEventsMessage(makeEventStore(static_cast<size_t>(state.range(0))), resolution);
+	for (auto _ : state)
+	{
+		auto events = dv_ros2_msgs::toEventStore(msg);
+		benchmark::DoNotOptimize(events);
+	}
+	setEventCounters(state);
+}
+} // namespace
+
+BENCHMARK(BM_ToRosEventsMessage)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ToEventStore)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ToEventStorePerEventCheck)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EncodeEvents, scalar, dv_ros2_msgs::_detail::EventKernel::Scalar)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_EncodeEvents, dispatched, dv_ros2_msgs::_detail::eventKernel())
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DecodeEvents, scalar, dv_ros2_msgs::_detail::EventKernel::Scalar)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_DecodeEvents, dispatched, dv_ros2_msgs::_detail::eventKernel())
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ToRosPackedEventsMessage)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_PackedToEventStore)->RangeMultiplier(10)->Range(1'000, 10'000'000)->Unit(benchmark::kMicrosecond);
+
+using dv_ros2_msgs::msg::CompressedEventPacket;
+BENCHMARK_CAPTURE(BM_ToRosCompressedEventsMessage, varint, CompressedEventPacket::COMPRESSION_NONE, 0)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ToRosCompressedEventsMessage, lz4, CompressedEventPacket::COMPRESSION_LZ4, 0)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ToRosCompressedEventsMessage, zstd_1, CompressedEventPacket::COMPRESSION_ZSTD, 1)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ToRosCompressedEventsMessage, zstd_9, CompressedEventPacket::COMPRESSION_ZSTD, 9)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CompressedToEventStore, varint, CompressedEventPacket::COMPRESSION_NONE, 0)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CompressedToEventStore, lz4, CompressedEventPacket::COMPRESSION_LZ4, 0)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_CompressedToEventStore, zstd_1, CompressedEventPacket::COMPRESSION_ZSTD, 1)
+	->RangeMultiplier(10)
+	->Range(1'000, 10'000'000)
+	->Unit(benchmark::kMicrosecond);
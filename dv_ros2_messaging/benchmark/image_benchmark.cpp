@@ -0,0 +1,124 @@
+#include <dv_ros2_messaging/image_pool.hpp>
+#include <dv_ros2_messaging/messaging.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <utility>
+
+namespace
+{
+/// Image of the resolution and channel count given by the benchmark arguments. A non-continuous image is a region of
+/// interest inside a wider buffer, so each row has to be copied separately.
+cv::Mat makeImage(const benchmark::State &state, const bool continuous)
+{
+	const int width  = static_cast<int>(state.range(0));
+	const int height = static_cast<int>(state.range(1));
+	const int type   = CV_MAKETYPE(CV_8U, static_cast<int>(state.range(2)));
+
+	cv::Mat buffer(height, continuous ? width : width + 64, type);
+	cv::randu(buffer, cv::Scalar::all(0), cv::Scalar::all(255));
+	return continuous ? buffer : buffer(cv::Rect(0, 0, width, height));
+}
+
+void setImageCounters(benchmark::State &state)
+{
+	const int64_t pixels = state.range(0) * state.range(1);
+	state.SetItemsProcessed(state.iterations() * pixels);
+	state.SetBytesProcessed(state.iterations() * pixels * state.range(2));
+}
+
+void BM_ToRosImageMessage(benchmark::State &state)
+{
+	const cv::Mat image = makeImage(state, true);
+	for (auto _ : state)
+	{
+		auto msg = dv_ros2_msgs::toRosImageMessage(image);
+		benchmark::DoNotOptimize(msg);
+	}
+	setImageCounters(state);
+}
+
+void BM_ToRosImageMessageNonContinuous(benchmark::State &state)
+{
+	const cv::Mat image = makeImage(state, false);
+	for (auto _ : state)
+	{
+		auto msg = dv_ros2_msgs::toRosImageMessage(image);
+		benchmark::DoNotOptimize(msg);
+	}
+	setImageCounters(state);
+}
+
+/// In place conversion into a message that is reused between iterations, as done by the capture node.
+void BM_ToRosImageMessageReused(benchmark::State &state)
+{
+	const cv::Mat image = makeImage(state, true);
+	sensor_msgs::msg::Image msg;
+	for (auto _ : state)
+	{
+		dv_ros2_msgs::toRosImageMessage(image, msg);
+		benchmark::DoNotOptimize(msg.data.data());
+	}
+	setImageCounters(state);
+}
+
+/// Conversion into messages recycled through the pool, as done by the publishing nodes.
+void BM_ImageMessagePool(benchmark::State &state)
+{
+	const cv::Mat image = makeImage(state, true);
+	dv_ros2_msgs::ImageMessagePool pool;
+	for (auto _ : state)
+	{
+		auto msg = pool.toRosImageMessage(image);
+		benchmark::DoNotOptimize(msg->data.data());
+		pool.recycle(std::move(msg));
+	}
+	setImageCounters(state);
+	state.counters["hits"]   = static_cast<double>(pool.hits());
+	state.counters["misses"] = static_cast<double>(pool.misses());
+}
+
+void BM_ToDvFrame(benchmark::State &state)
+{
+	const auto msg = dv_ros2_msgs::frameToRosImageMessage(dv::Frame(1'000, makeImage(state, true)));
+	for (auto _ : state)
+	{
+		auto frame = dv_ros2_msgs::toDvFrame(msg);
+		benchmark::DoNotOptimize(frame.image.data);
+	}
+	setImageCounters(state);
+}
+
+void BM_FrameMap(benchmark::State &state)
+{
+	const auto msg = std::make_shared<const sensor_msgs::msg::Image>(
+		dv_ros2_msgs::frameToRosImageMessage(dv::Frame(1'000, makeImage(state, true))));
+	for (auto _ : state)
+	{
+		dv_ros2_msgs::FrameMap map(msg);
+		benchmark::DoNotOptimize(map.frame.image.data);
+	}
+	setImageCounters(state);
+}
+
+/// DAVIS346, VGA, HD and Full HD sensors with mono and BGR images.
+void imageArguments(benchmark::internal::Benchmark *benchmark)
+{
+	benchmark->ArgNames({"width", "height", "channels"});
+	const std::initializer_list<std::pair<int, int>> resolutions{{346, 260}, {640, 480}, {1280, 720}, {1920, 1080}};
+	for (const auto &[width, height] : resolutions)
+	{
+		for (const int channels : {1, 3})
+		{
+			benchmark->Args({width, height, channels});
+		}
+	}
+}
+} // namespace
+
+BENCHMARK(BM_ToRosImageMessage)->Apply(imageArguments);
+BENCHMARK(BM_ToRosImageMessageNonContinuous)->Apply(imageArguments);
+BENCHMARK(BM_ToRosImageMessageReused)->Apply(imageArguments);
+BENCHMARK(BM_ImageMessagePool)->Apply(imageArguments);
+BENCHMARK(BM_ToDvFrame)->Apply(imageArguments);
+BENCHMARK(BM_FrameMap)->Apply(imageArguments);
@@ -0,0 +1,119 @@
+#include <dv_ros2_messaging/messaging.hpp>
+
+#include <dv-processing/kinematics/transformation.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+namespace
+{
+dv::cvector<dv::IMU> makeImuBatch(const size_t size)
+{
+	std::mt19937 generator(42);
+	std::uniform_real_distribution<float> distribution(-2.f, 2.f);
+
+	dv::cvector<dv::IMU> batch;
+	batch.reserve(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		auto &imu          = batch.emplace_back();
+		imu.timestamp      = 1'700'000'000'000'000 + static_cast<int64_t>(i) * 125;
+		imu.accelerometerX = distribution(generator);
+		imu.accelerometerY = distribution(generator);
+		imu.accelerometerZ = distribution(generator);
+		imu.gyroscopeX     = distribution(generator) * 100.f;
+		imu.gyroscopeY     = distribution(generator) * 100.f;
+		imu.gyroscopeZ     = distribution(generator) * 100.f;
+	}
+	return batch;
+}
+
+const Eigen::Vector3f accBiases(0.12f, -0.08f, 0.05f);
+const Eigen::Vector3f gyroBiases(0.01f, 0.02f, -0.015f);
+const dv::kinematics::Transformationf imuToCamera(
+	0, Eigen::Vector3f::Zero(), Eigen::Quaternionf(Eigen::AngleAxisf(0.3f, Eigen::Vector3f::UnitZ())));
+
+/// Plain per sample conversion without any correction.
+void BM_ToRosImuMessage(benchmark::State &state)
+{
+	const auto batch = makeImuBatch(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		for (const auto &imu : batch)
+		{
+			auto sample = dv_ros2_msgs::toRosImuMessage(imu);
+			benchmark::DoNotOptimize(sample);
+		}
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+	state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<int64_t>(sizeof(dv::IMU)));
+}
+
+/// Per sample conversion, bias removal and two rotatePoint calls, as previously done by the capture node.
+void BM_ImuPerSample(benchmark::State &state)
+{
+	const auto batch = makeImuBatch(static_cast<size_t>(state.range(0)));
+	for (auto _ : state)
+	{
+		dv_ros2_msgs::msg::ImuArray msg;
+		msg.samples.reserve(batch.size());
+		for (const auto &imu : batch)
+		{
+			auto sample = dv_ros2_msgs::toRosImuMessage(imu);
+			sample.linear_acceleration.x -= accBiases.x();
+			sample.linear_acceleration.y -= accBiases.y();
+			sample.linear_acceleration.z -= accBiases.z();
+			sample.angular_velocity.x -= gyroBiases.x();
+			sample.angular_velocity.y -= gyroBiases.y();
+			sample.angular_velocity.z -= gyroBiases.z();
+
+			const Eigen::Vector3d resW   = imuToCamera.rotatePoint<Eigen::Vector3d>(sample.angular_velocity);
+			sample.angular_velocity.x    = resW.x();
+			sample.angular_velocity.y    = resW.y();
+			sample.angular_velocity.z    = resW.z();
+			const Eigen::Vector3d resV   = imuToCamera.rotatePoint<Eigen::Vector3d>(sample.linear_acceleration);
+			sample.linear_acceleration.x = resV.x();
+			sample.linear_acceleration.y = resV.y();
+			sample.linear_acceleration.z = resV.z();
+			msg.samples.push_back(sample);
+		}
+		benchmark::DoNotOptimize(msg);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// Whole batch through the 3xN kernel, including filling the ImuArray message.
+void BM_ImuBatch(benchmark::State &state)
+{
+	const auto batch              = makeImuBatch(static_cast<size_t>(state.range(0)));
+	const Eigen::Matrix3f rotation = imuToCamera.getTransform().block<3, 3>(0, 0);
+	for (auto _ : state)
+	{
+		auto msg = dv_ros2_msgs::toRosImuArrayMessage(batch, accBiases, gyroBiases, rotation);
+		benchmark::DoNotOptimize(msg);
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/// The 3xN kernel alone, without message construction.
+void BM_ImuBatchKernel(benchmark::State &state)
+{
+	const auto batch              = makeImuBatch(static_cast<size_t>(state.range(0)));
+	const Eigen::Matrix3f rotation = imuToCamera.getTransform().block<3, 3>(0, 0);
+	Eigen::Matrix3Xf accelerations;
+	Eigen::Matrix3Xf angularVelocities;
+	for (auto _ : state)
+	{
+		dv_ros2_msgs::correctImuBatch(batch, accBiases, gyroBiases, rotation, accelerations, angularVelocities);
+		benchmark::DoNotOptimize(accelerations.data());
+		benchmark::DoNotOptimize(angularVelocities.data());
+	}
+	state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+} // namespace
+
+BENCHMARK(BM_ToRosImuMessage)->RangeMultiplier(8)->Range(8, 8192);
+BENCHMARK(BM_ImuPerSample)->RangeMultiplier(8)->Range(8, 8192);
+BENCHMARK(BM_ImuBatch)->RangeMultiplier(8)->Range(8, 8192);
+BENCHMARK(BM_ImuBatchKernel)->RangeMultiplier(8)->Range(8, 8192);
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace dv_ros2_msgs
+{
+
+/// @brief Subscriber demand of a set of publishers, used to skip rendering and conversion work that nobody listens to.
+/// The subscription counts are queried from the ROS graph at most once per poll interval, the cached answer can be
+/// read from any thread.
+class PublisherDemand
+{
+public:
+	/// @brief Demand reported by poll().
+	enum class State
+	{
+		/// @brief None of the publishers has a subscriber.
+		Idle,
+		/// @brief A subscriber appeared since the previous poll, state built from the skipped input should be reset.
+		Resumed,
+		/// @brief At least one of the publishers has a subscriber.
+		Active
+	};
+
+	/// @brief Create an empty demand, publishers are added with track().
+	/// @param interval Minimum time between two queries of the ROS graph.
+	explicit PublisherDemand(const std::chrono::milliseconds interval = std::chrono::milliseconds(100)) :
+		m_interval(std::chrono::duration_cast<std::chrono::steady_clock::duration>(interval).count())
+	{
+	}
+
+	/// @brief Add a publisher whose subscribers create demand, must not be called concurrently with poll().
+	/// @param publisher Publisher to track.
+	void track(const rclcpp::PublisherBase::SharedPtr &publisher)
+	{
+		m_publishers.push_back(publisher);
+	}
+
+	/// @brief Refresh the demand if the poll interval elapsed and report the transitions, must be called from a single
+	/// thread.
+	/// @return Idle if the work can be skipped, Resumed on the first poll with demand after an idle period, Active
+	/// otherwise.
+	[[nodiscard]] State poll()
+	{
+		const int64_t now = std::chrono::steady_clock::now().time_since_epoch().count();
+		if (now >= m_next_query)
+		{
+			m_next_query = now + m_interval;
+			m_active.store(std::any_of(m_publishers.begin(), m_publishers.end(),
+							   [](const rclcpp::PublisherBase::SharedPtr &publisher)
+							   {
+								   return publisher->get_subscription_count() > 0;
+							   }),
+				std::memory_order_relaxed);
+		}
+
+		const bool active  = m_active.load(std::memory_order_relaxed);
+		const bool resumed = active && !m_reported;
+		m_reported         = active;
+		if (!active)
+		{
+			return State::Idle;
+		}
+		return resumed ? State::Resumed : State::Active;
+	}
+
+	/// @brief Demand at the latest poll, without querying the ROS graph.
+	/// @return True if at least one publisher had a subscriber.
+	[[nodiscard]] bool active() const
+	{
+		return m_active.load(std::memory_order_relaxed);
+	}
+
+private:
+	std::vector<rclcpp::PublisherBase::SharedPtr> m_publishers;
+	int64_t m_interval;
+	int64_t m_next_query = 0;
+	std::atomic<bool> m_active{false};
+	bool m_reported = false;
+};
+
+} // namespace dv_ros2_msgs
@@ -0,0 +1,318 @@
+#pragma once
+
+#include <dv-processing/core/core.hpp>
+
+#include <dv_ros2_msgs/msg/event.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+	#define DV_ROS2_MSGS_EVENT_KERNELS_AVX2
+	#include <immintrin.h>
+#elif defined(__aarch64__) && defined(__ARM_NEON) && defined(DV_ROS2_MSGS_ENABLE_NEON_KERNELS)
+	// Opt-in until the NEON kernels were verified by the kernel equivalence test on an aarch64 build
+	#define DV_ROS2_MSGS_EVENT_KERNELS_NEON
+	#include <arm_neon.h>
+#endif
+
+namespace dv_ros2_msgs::_detail
+{
+
+// The kernels move whole 16 byte events between the two layouts:
+// dv::Event                  | timestamp (8) | x (2) | y (2) | polarity (1) | padding (3) |
+// dv_ros2_msgs::msg::Event   | x (2) | y (2) | ts.sec (4) | ts.nanosec (4) | polarity (1) | padding (3) |
+static_assert(sizeof(dv::Event) == 16, "Unexpected dv::Event layout");
+static_assert(std::is_standard_layout_v<dv_ros2_msgs::msg::Event>, "Unexpected event message layout");
+static_assert(sizeof(dv_ros2_msgs::msg::Event) == 16 && offsetof(dv_ros2_msgs::msg::Event, x) == 0
+				  && offsetof(dv_ros2_msgs::msg::Event, y) == 2 && offsetof(dv_ros2_msgs::msg::Event, ts) == 4
+				  && offsetof(dv_ros2_msgs::msg::Event, polarity) == 12,
+	"Unexpected event message layout");
+
+/// @brief Multiplier and shift for an exact division of any 32-bit nanosecond value by 1000.
+inline constexpr uint64_t nanosecondDivisor = 274'877'907;
+inline constexpr int nanosecondShift        = 38;
+
+/// @brief Instruction set used by the event conversion kernels.
+enum class EventKernel
+{
+	Scalar,
+	Avx2,
+	Neon
+};
+
+/// @brief Detect the best event conversion kernel supported by the running CPU.
+/// @return Event kernel
+[[nodiscard]] inline EventKernel detectEventKernel()
+{
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_AVX2)
+	return __builtin_cpu_supports("avx2") ? EventKernel::Avx2 : EventKernel::Scalar;
+#elif defined(DV_ROS2_MSGS_EVENT_KERNELS_NEON)
+	return EventKernel::Neon;
+#else
+	return EventKernel::Scalar;
+#endif
+}
+
+/// @brief Event conversion kernel of the running CPU, detected once.
+/// @return Event kernel
+[[nodiscard]] inline EventKernel eventKernel()
+{
+	static const EventKernel kernel = detectEventKernel();
+	return kernel;
+}
+
+/// @brief Convert a single event into the message layout.
+/// @param event DV event
+/// @param secondBegin Timestamp of the beginning of the second the event falls into, in microseconds
+/// @param second The second the event falls into
+/// @param output Message event to fill
+inline void encodeEvent(const dv::Event &event, const int64_t secondBegin, const int32_t second,
+	dv_ros2_msgs::msg::Event &output)
+{
+	output.x          = static_cast<uint16_t>(event.x());
+	output.y          = static_cast<uint16_t>(event.y());
+	output.ts.sec     = second;
+	output.ts.nanosec = static_cast<uint32_t>((event.timestamp() - secondBegin) * 1'000);
+	output.polarity   = event.polarity();
+}
+
+/// @brief Convert a single message event into dv::Event.
+/// @param event Message event
+/// @return DV event
+[[nodiscard]] inline dv::Event decodeEvent(const dv_ros2_msgs::msg::Event &event)
+{
+	return {(static_cast<int64_t>(event.ts.sec) * 1'000'000) + static_cast<int64_t>(event.ts.nanosec / 1'000),
+		static_cast<int16_t>(event.x), static_cast<int16_t>(event.y), static_cast<uint8_t>(event.polarity)};
+}
+
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_AVX2)
+/// @brief Convert blocks of four events that fall into the same second, two events per register.
+/// @return Number of converted events
+__attribute__((target("avx2"))) inline size_t encodeEventBlocksAvx2(const dv::Event *input, const size_t size,
+	const int64_t secondBegin, const int32_t second, dv_ros2_msgs::msg::Event *output)
+{
+	const int64_t secondEnd = secondBegin + 1'000'000;
+	const __m256i begin     = _mm256_setr_epi64x(secondBegin, 0, secondBegin, 0);
+	const __m256i scale     = _mm256_setr_epi32(1'000, 1, 1, 1, 1'000, 1, 1, 1);
+	const __m256i seconds   = _mm256_setr_epi32(0, second, 0, 0, 0, second, 0, 0);
+	// Per event: x and y into bytes 0-3, nanoseconds into bytes 8-11, polarity into byte 12
+	const __m256i shuffle = _mm256_setr_epi8(8, 9, 10, 11, -1, -1, -1, -1, 0, 1, 2, 3, 12, -1, -1, -1, 8, 9, 10, 11,
+		-1, -1, -1, -1, 0, 1, 2, 3, 12, -1, -1, -1);
+
+	size_t i = 0;
+	for (; i + 4 <= size && input[i + 3].timestamp() < secondEnd; i += 4)
+	{
+		for (size_t j = i; j < i + 4; j += 2)
+		{
+			const __m256i events      = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + j));
+			const __m256i nanoseconds = _mm256_mullo_epi32(_mm256_sub_epi64(events, begin), scale);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + j),
+				_mm256_or_si256(_mm256_shuffle_epi8(nanoseconds, shuffle), seconds));
+		}
+	}
+	return i;
+}
+
+/// @brief Convert blocks of four message events that fall into the same second, two events per register.
+/// @return Number of converted events
+__attribute__((target("avx2"))) inline size_t decodeEventBlocksAvx2(const dv_ros2_msgs::msg::Event *input,
+	const size_t size, const int32_t second, const int64_t secondBegin, dv::Event *output)
+{
+	const __m256i seconds = _mm256_set1_epi32(second);
+	const __m256i begin   = _mm256_setr_epi64x(secondBegin, 0, secondBegin, 0);
+	const __m256i divisor = _mm256_set1_epi64x(static_cast<int64_t>(nanosecondDivisor));
+	// Per event: x and y into bytes 8-11, polarity into byte 12
+	const __m256i shuffle = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 12, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, 0, 1, 2, 3, 12, -1, -1, -1);
+
+	size_t i = 0;
+	for (; i + 4 <= size; i += 4)
+	{
+		const __m256i firstPair  = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i));
+		const __m256i secondPair = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(input + i + 2));
+
+		// ts.sec is the second 32-bit word of every event
+		const __m256i sameSecond
+			= _mm256_and_si256(_mm256_cmpeq_epi32(firstPair, seconds), _mm256_cmpeq_epi32(secondPair, seconds));
+		if ((_mm256_movemask_epi8(sameSecond) & 0x00F000F0) != 0x00F000F0)
+		{
+			break;
+		}
+
+		for (size_t j = i; j < i + 4; j += 2)
+		{
+			const __m256i events = j == i ? firstPair : secondPair;
+			// ts.nanosec is moved into the low word of the first 64-bit lane, divided by 1000 and rebased
+			const __m256i microseconds = _mm256_srli_epi64(
+				_mm256_mul_epu32(_mm256_srli_si256(events, 8), divisor), nanosecondShift);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(output + j),
+				_mm256_or_si256(_mm256_add_epi64(microseconds, begin), _mm256_shuffle_epi8(events, shuffle)));
+		}
+	}
+	return i;
+}
+#endif
+
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_NEON)
+/// @brief Convert blocks of four events that fall into the same second, one event per register.
+/// @return Number of converted events
+inline size_t encodeEventBlocksNeon(const dv::Event *input, const size_t size, const int64_t secondBegin,
+	const int32_t second, dv_ros2_msgs::msg::Event *output)
+{
+	const int64_t secondEnd = secondBegin + 1'000'000;
+	const int64x2_t begin   = vcombine_s64(vdup_n_s64(secondBegin), vdup_n_s64(0));
+	const uint32x4_t scale  = {1'000, 1, 1, 1};
+	const uint32x4_t seconds = {0, static_cast<uint32_t>(second), 0, 0};
+	// x and y into bytes 0-3, nanoseconds into bytes 8-11, polarity into byte 12
+	const uint8x16_t shuffle = {8, 9, 10, 11, 255, 255, 255, 255, 0, 1, 2, 3, 12, 255, 255, 255};
+
+	size_t i = 0;
+	for (; i + 4 <= size && input[i + 3].timestamp() < secondEnd; i += 4)
+	{
+		for (size_t j = i; j < i + 4; ++j)
+		{
+			const int64x2_t event = vld1q_s64(reinterpret_cast<const int64_t *>(input + j));
+			const uint32x4_t nanoseconds = vmulq_u32(vreinterpretq_u32_s64(vsubq_s64(event, begin)), scale);
+			const uint8x16_t converted   = vqtbl1q_u8(vreinterpretq_u8_u32(nanoseconds), shuffle);
+			vst1q_u32(reinterpret_cast<uint32_t *>(output + j), vorrq_u32(vreinterpretq_u32_u8(converted), seconds));
+		}
+	}
+	return i;
+}
+
+/// @brief Convert blocks of four message events that fall into the same second, one event per register.
+/// @return Number of converted events
+inline size_t decodeEventBlocksNeon(const dv_ros2_msgs::msg::Event *input, const size_t size, const int32_t second,
+	const int64_t secondBegin, dv::Event *output)
+{
+	const uint64x1_t begin = vdup_n_u64(static_cast<uint64_t>(secondBegin));
+	// x and y into bytes 0-3, polarity into byte 4
+	const uint8x16_t shuffle = {0, 1, 2, 3, 12, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255};
+
+	size_t i = 0;
+	for (; i + 4 <= size; i += 4)
+	{
+		if (input[i].ts.sec != second || input[i + 1].ts.sec != second || input[i + 2].ts.sec != second
+			|| input[i + 3].ts.sec != second)
+		{
+			break;
+		}
+		for (size_t j = i; j < i + 4; ++j)
+		{
+			const uint32x4_t event = vld1q_u32(reinterpret_cast<const uint32_t *>(input + j));
+			// ts.nanosec is the third 32-bit word, divided by 1000 and rebased
+			const uint64x2_t microseconds
+				= vshrq_n_u64(vmull_n_u32(vget_high_u32(event), static_cast<uint32_t>(nanosecondDivisor)), nanosecondShift);
+			const uint8x16_t fields = vqtbl1q_u8(vreinterpretq_u8_u32(event), shuffle);
+			vst1q_u64(reinterpret_cast<uint64_t *>(output + j),
+				vcombine_u64(vadd_u64(vget_low_u64(microseconds), begin), vreinterpret_u64_u8(vget_low_u8(fields))));
+		}
+	}
+	return i;
+}
+#endif
+
+/// @brief Convert as many blocks of events falling into the same second as possible with the given kernel.
+/// @return Number of converted events, zero for the scalar kernel
+inline size_t encodeEventBlocks(const EventKernel kernel, const dv::Event *input, const size_t size,
+	const int64_t secondBegin, const int32_t second, dv_ros2_msgs::msg::Event *output)
+{
+	switch (kernel)
+	{
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_AVX2)
+		case EventKernel::Avx2:
+			return encodeEventBlocksAvx2(input, size, secondBegin, second, output);
+#endif
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_NEON)
+		case EventKernel::Neon:
+			return encodeEventBlocksNeon(input, size, secondBegin, second, output);
+#endif
+		default:
+			return 0;
+	}
+}
+
+/// @brief Convert as many blocks of message events falling into the same second as possible with the given kernel.
+/// @return Number of converted events, zero for the scalar kernel
+inline size_t decodeEventBlocks(const EventKernel kernel, const dv_ros2_msgs::msg::Event *input, const size_t size,
+	const int32_t second, const int64_t secondBegin, dv::Event *output)
+{
+	switch (kernel)
+	{
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_AVX2)
+		case EventKernel::Avx2:
+			return decodeEventBlocksAvx2(input, size, second, secondBegin, output);
+#endif
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_NEON)
+		case EventKernel::Neon:
+			return decodeEventBlocksNeon(input, size, second, secondBegin, output);
+#endif
+		default:
+			return 0;
+	}
+}
+
+/// @brief Convert a contiguous, time ordered range of events into message events. Runs of events within the same
+///        second are converted in blocks by the kernel, the remainder of each run event by event.
+/// @param input DV events
+/// @param size Number of events
+/// @param output Preallocated message events
+/// @param kernel Kernel to use, defaults to the best kernel of the running CPU
+inline void encodeEvents(const dv::Event *input, const size_t size, dv_ros2_msgs::msg::Event *output,
+	const EventKernel kernel = eventKernel())
+{
+	size_t i = 0;
+	while (i < size)
+	{
+		const auto second         = static_cast<int32_t>(input[i].timestamp() / 1'000'000);
+		const int64_t secondBegin = static_cast<int64_t>(second) * 1'000'000;
+		const int64_t secondEnd   = secondBegin + 1'000'000;
+
+		i += encodeEventBlocks(kernel, input + i, size - i, secondBegin, second, output + i);
+		for (; i < size && input[i].timestamp() < secondEnd; ++i)
+		{
+			encodeEvent(input[i], secondBegin, second, output[i]);
+		}
+	}
+}
+
+/// @brief Convert a contiguous range of message events into dv::Event. Runs of events within the same second are
+///        converted in blocks by the kernel, the remainder of each run event by event.
+/// @param input Message events
+/// @param size Number of events
+/// @param output Preallocated DV events
+/// @param kernel Kernel to use, defaults to the best kernel of the running CPU
+inline void decodeEvents(const dv_ros2_msgs::msg::Event *input, const size_t size, dv::Event *output,
+	const EventKernel kernel = eventKernel())
+{
+	size_t i = 0;
+	while (i < size)
+	{
+		const int32_t second      = input[i].ts.sec;
+		const int64_t secondBegin = static_cast<int64_t>(second) * 1'000'000;
+
+		i += decodeEventBlocks(kernel, input + i, size - i, second, secondBegin, output + i);
+		for (; i < size && input[i].ts.sec == second; ++i)
+		{
+			output[i] = decodeEvent(input[i]);
+		}
+	}
+}
+
+/// @brief Access the events of a store as a single array, which is possible if the store holds one contiguous range.
+/// @param events DV EventStore
+/// @return Pointer to the first event, or nullptr if the store is empty or split over several buffers
+[[nodiscard]] inline const dv::Event *contiguousEvents(const dv::EventStore &events)
+{
+	if (events.isEmpty())
+	{
+		return nullptr;
+	}
+	const dv::Event *first = &events.front();
+	const auto span = reinterpret_cast<uintptr_t>(&events.back()) - reinterpret_cast<uintptr_t>(first);
+	return span == (events.size() - 1) * sizeof(dv::Event) ? first : nullptr;
+}
+
+} // namespace dv_ros2_msgs::_detail
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <dv_ros2_messaging/messaging.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace dv_ros2_msgs
+{
+
+/// @brief Pool of image messages keyed by resolution and encoding. Images of a steady stream are converted into a
+/// recycled message whose data buffer already has the right size, so publishing does not allocate or page fault.
+///
+/// The pool only helps publishers without intra-process subscribers. Intra-process subscribers take the ownership of
+/// the published message and never return it, so for those publishers the pool is bypassed and every image is
+/// converted into a newly allocated message.
+class ImageMessagePool
+{
+public:
+	using MessagePtr = std::unique_ptr<sensor_msgs::msg::Image>;
+
+	/// @brief Create an empty pool.
+	/// @param capacity Maximum number of idle messages kept by the pool.
+	explicit ImageMessagePool(const size_t capacity = 4) : m_capacity(capacity)
+	{
+	}
+
+	/// @brief Convert OpenCV image into a pooled ROS image message, see toRosImageMessage.
+	/// @param image OpenCV image
+	/// @return Image message, reused from the pool if one with the same resolution and encoding is idle
+	/// @throw dv::exceptions::RuntimeError if image data layout is not supported
+	[[nodiscard]] MessagePtr toRosImageMessage(const cv::Mat &image)
+	{
+		const std::string encoding = image.empty() ? std::string() : _detail::imageEncoding(image.type());
+
+		MessagePtr msg;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			for (auto iter = m_idle.rbegin(); iter != m_idle.rend(); ++iter)
+			{
+				const auto &candidate = **iter;
+				if (static_cast<int>(candidate.width) == image.cols && static_cast<int>(candidate.height) == image.rows
+					&& candidate.encoding == encoding)
+				{
+					msg = std::move(*iter);
+					m_idle.erase(std::next(iter).base());
+					break;
+				}
+			}
+		}
+
+		if (msg != nullptr)
+		{
+			m_hits.fetch_add(1, std::memory_order_relaxed);
+		}
+		else
+		{
+			m_misses.fetch_add(1, std::memory_order_relaxed);
+			msg = std::make_unique<sensor_msgs::msg::Image>();
+		}
+		dv_ros2_msgs::toRosImageMessage(image, *msg);
+		return msg;
+	}
+
+	/// @brief Return a message to the pool, the oldest idle message is released if the pool is full.
+	/// @param msg Message previously obtained from the pool
+	void recycle(MessagePtr msg)
+	{
+		if (msg == nullptr || m_capacity == 0)
+		{
+			return;
+		}
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_idle.size() >= m_capacity)
+		{
+			m_idle.erase(m_idle.begin());
+		}
+		m_idle.push_back(std::move(msg));
+	}
+
+	/// @brief Convert and publish an image. Loaned messages are used if the middleware supports them. Otherwise the
+	/// message is published from the pool and recycled. The pool is bypassed if the publisher has intra-process
+	/// subscribers, they take the ownership of the message so it could not be recycled.
+	/// @param publisher Image publisher
+	/// @param image OpenCV image
+	/// @param stamp Timestamp of the message header
+	/// @param frameId Frame id of the message header
+	/// @throw dv::exceptions::RuntimeError if image data layout is not supported
+	void publish(rclcpp::Publisher<sensor_msgs::msg::Image> &publisher, const cv::Mat &image,
+		const builtin_interfaces::msg::Time &stamp, const std::string &frameId = std::string())
+	{
+		if (publisher.can_loan_messages())
+		{
+			publishLoaned(publisher, [&](sensor_msgs::msg::Image &msg)
+			{
+				dv_ros2_msgs::toRosImageMessage(image, msg);
+				msg.header.stamp    = stamp;
+				msg.header.frame_id = frameId;
+			});
+			return;
+		}
+
+		if (publisher.get_intra_process_subscription_count() > 0)
+		{
+			// Taking a message from the pool would only drain it, the subscribers keep the message
+			auto msg = std::make_unique<sensor_msgs::msg::Image>();
+			dv_ros2_msgs::toRosImageMessage(image, *msg);
+			msg->header.stamp    = stamp;
+			msg->header.frame_id = frameId;
+			publisher.publish(std::move(msg));
+			return;
+		}
+
+		// Serialized directly when there are no intra-process subscribers, the message can be reused afterwards
+		auto msg             = toRosImageMessage(image);
+		msg->header.stamp    = stamp;
+		msg->header.frame_id = frameId;
+		publisher.publish(*msg);
+		recycle(std::move(msg));
+	}
+
+	/// @brief Number of conversions which reused an idle message.
+	/// @return Hit counter
+	[[nodiscard]] uint64_t hits() const
+	{
+		return m_hits.load(std::memory_order_relaxed);
+	}
+
+	/// @brief Number of conversions which had to allocate a new message.
+	/// @return Miss counter
+	[[nodiscard]] uint64_t misses() const
+	{
+		return m_misses.load(std::memory_order_relaxed);
+	}
+
+private:
+	size_t m_capacity;
+	std::mutex m_mutex;
+	std::vector<MessagePtr> m_idle;
+	std::atomic<uint64_t> m_hits{0};
+	std::atomic<uint64_t> m_misses{0};
+};
+
+} // namespace dv_ros2_msgs
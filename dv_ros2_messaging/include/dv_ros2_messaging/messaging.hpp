@@ -7,24 +7,58 @@
 
 #define DV_ROS_MSGS(type) type##_<boost::container::allocator<void>>
 
+#include <dv_ros2_messaging/event_kernels.hpp>
+
+#include <dv_ros2_msgs/msg/bounded_event_packet.hpp>
+#include <dv_ros2_msgs/msg/compressed_event_packet.hpp>
 #include <dv_ros2_msgs/msg/event_array.hpp>
 #include <dv_ros2_msgs/msg/event_packet.hpp>
+#include <dv_ros2_msgs/msg/imu_array.hpp>
+#include <dv_ros2_msgs/msg/packed_event_array.hpp>
 #include <dv_ros2_msgs/msg/trigger.hpp>
+#include <dv_ros2_msgs/msg/trigger_array.hpp>
 
 #include <boost/bind/bind.hpp>
 #include <boost/container/allocator.hpp>
 #include <opencv2/core.hpp>
+#include <Eigen/Core>
+#include <lz4.h>
+#include <lz4hc.h>
+#include <zstd.h>
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
 
 #include <sensor_msgs/msg/image.hpp>
 #include <sensor_msgs/msg/camera_info.hpp>
 #include <sensor_msgs/msg/imu.hpp>
 #include <sensor_msgs/image_encodings.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <rclcpp/type_adapter.hpp>
 
 namespace dv_ros2_msgs 
 {
 
 namespace _detail {
+/// @brief Image encoding of an OpenCV image type, only single channel 8-bit and three channel 8-bit BGR images are
+/// supported.
+[[nodiscard]] inline const char *imageEncoding(const int type)
+{
+	switch (type)
+	{
+		case CV_8UC1:
+			return sensor_msgs::image_encodings::MONO8;
+		case CV_8UC3:
+			return sensor_msgs::image_encodings::BGR8;
+		default:
+			throw dv::exceptions::RuntimeError("Received unsupported image type");
+	}
+}
+
 [[nodiscard]] inline int32_t imageTypeFromEncoding(const std::string &encoding) 
 {
 	if (sensor_msgs::image_encodings::isBayer(encoding)) 
@@ -48,6 +82,194 @@ namespace _detail {
 			throw dv::exceptions::InvalidArgument<int>("Unsupported image bit depth", depth);
 	}
 }
+
+/// @brief Largest width of the timestamp difference field of PackedEventArray messages, in bits.
+inline constexpr uint8_t maxPackedTimeBits = 32;
+
+/// @brief Number of bits needed to represent a value.
+[[nodiscard]] inline uint8_t bitWidth(uint64_t value)
+{
+	uint8_t bits = 0;
+	while (value != 0)
+	{
+		++bits;
+		value >>= 1;
+	}
+	return bits;
+}
+
+/// @brief Value with the given number of lowest bits set.
+[[nodiscard]] inline uint64_t lowBitMask(const uint8_t bits)
+{
+	return bits >= 64 ? ~uint64_t{0} : (uint64_t{1} << bits) - 1;
+}
+
+/// @brief Number of 64-bit words of a PackedEventArray bit stream.
+[[nodiscard]] inline size_t packedWordCount(const size_t count, const uint8_t bitsPerEvent)
+{
+	return (count * bitsPerEvent + 63) / 64;
+}
+
+/// @brief Appends fixed width fields of at most 64 bits to a bit stream of 64-bit words, least significant bit first.
+class BitWriter
+{
+public:
+	explicit BitWriter(std::vector<uint64_t> &words) : m_words(words)
+	{
+	}
+
+	/// @brief Append a field, the value must fit into the given number of bits.
+	void write(const uint64_t value, const uint8_t bits)
+	{
+		if (bits == 0)
+		{
+			return;
+		}
+		m_current |= value << m_used;
+		const uint32_t used = m_used + bits;
+		if (used >= 64)
+		{
+			m_words.push_back(m_current);
+			m_current = m_used == 0 ? 0 : value >> (64 - m_used);
+			m_used    = used - 64;
+		}
+		else
+		{
+			m_used = used;
+		}
+	}
+
+	/// @brief Write out the last partially filled word.
+	void flush()
+	{
+		if (m_used > 0)
+		{
+			m_words.push_back(m_current);
+			m_current = 0;
+			m_used    = 0;
+		}
+	}
+
+private:
+	std::vector<uint64_t> &m_words;
+	uint64_t m_current = 0;
+	uint32_t m_used    = 0;
+};
+
+/// @brief Reads fixed width fields of at most 64 bits from a bit stream written by BitWriter. The caller validates
+///        the length of the stream, reading past its end returns zero bits.
+class BitReader
+{
+public:
+	BitReader(const uint64_t *words, const size_t count) : m_words(words), m_end(words + count)
+	{
+		m_current = m_words != m_end ? *m_words++ : 0;
+	}
+
+	/// @brief Read the next field.
+	[[nodiscard]] uint64_t read(const uint8_t bits)
+	{
+		if (bits == 0)
+		{
+			return 0;
+		}
+		uint64_t value           = m_current >> m_used;
+		const uint32_t available = 64 - m_used;
+		if (bits < available)
+		{
+			m_used += bits;
+			return value & lowBitMask(bits);
+		}
+		m_current = m_words != m_end ? *m_words++ : 0;
+		if (bits > available)
+		{
+			value |= m_current << available;
+		}
+		m_used = bits - available;
+		return value & lowBitMask(bits);
+	}
+
+private:
+	const uint64_t *m_words;
+	const uint64_t *m_end;
+	uint64_t m_current = 0;
+	uint32_t m_used    = 0;
+};
+
+/// Conversion from degrees to radians for gyroscope measurements.
+inline constexpr float imuDeg2Rad = 3.14159265358979323846f / 180.0f;
+
+/// Conversion from g to m/s^2 for accelerometer measurements.
+inline constexpr float imuEarthG = 9.81007f;
+
+/// @brief Convert a message timestamp into UNIX microsecond timestamp using integer arithmetic only.
+[[nodiscard]] inline int64_t stampToMicroseconds(const builtin_interfaces::msg::Time &stamp)
+{
+	return (static_cast<int64_t>(stamp.sec) * 1'000'000) + static_cast<int64_t>(stamp.nanosec / 1'000);
+}
+
+/// @brief Largest size of a single event in a CompressedEventPacket varint stream: a 64-bit timestamp delta and two
+///        coordinate deltas of at most 18 bits each.
+inline constexpr size_t maxEncodedEventSize = 16;
+
+/// @brief Smallest size of a single event in a CompressedEventPacket varint stream, one byte per varint field.
+inline constexpr size_t minEncodedEventSize = 3;
+
+/// @brief Write an unsigned LEB128 varint.
+/// @param value Value to write
+/// @param output Output buffer with space for at least 10 bytes
+/// @return Position after the written varint
+inline uint8_t *writeVarint(uint64_t value, uint8_t *output)
+{
+	while (value >= 0x80)
+	{
+		*output++ = static_cast<uint8_t>(value | 0x80);
+		value >>= 7;
+	}
+	*output++ = static_cast<uint8_t>(value);
+	return output;
+}
+
+/// @brief Read an unsigned LEB128 varint.
+/// @param input Read position, advanced past the varint
+/// @param end End of the input buffer
+/// @return Decoded value
+/// @throws InvalidArgument If the input ends in the middle of the varint or the varint is longer than 64 bits
+inline uint64_t readVarint(const uint8_t *&input, const uint8_t *end)
+{
+	// Single byte varints are by far the most common case for event deltas
+	if (input != end && *input < 0x80)
+	{
+		return *input++;
+	}
+	uint64_t value = 0;
+	for (int shift = 0; shift < 64; shift += 7)
+	{
+		if (input == end)
+		{
+			throw dv::exceptions::InvalidArgument<int>("Truncated varint in compressed event message", shift / 7);
+		}
+		const uint8_t byte = *input++;
+		value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+		if ((byte & 0x80) == 0)
+		{
+			return value;
+		}
+	}
+	throw dv::exceptions::InvalidArgument<uint64_t>("Varint in compressed event message is too long", value);
+}
+
+/// @brief Map signed values onto unsigned ones so that small magnitudes result in short varints.
+[[nodiscard]] inline uint64_t zigzagEncode(const int64_t value)
+{
+	return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+/// @brief Inverse of zigzagEncode.
+[[nodiscard]] inline int64_t zigzagDecode(const uint64_t value)
+{
+	return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
 } // namespace _detail
 
 /// @brief Converts UNIX microsecond timestamp into rclcpp::Time format.
@@ -63,39 +285,36 @@ namespace _detail {
 /// @return DV format UNIX microsecond timestamp
 [[nodiscard]] inline int64_t toDvTime(const rclcpp::Time &timestamp) 
 {
-	return (static_cast<int64_t>(timestamp.seconds()) * 1'000'000) + (timestamp.nanoseconds() / 1'000);
+	return timestamp.nanoseconds() / 1'000;
 }
 
-/// @brief Convert OpenCV image into ROS image message. Supports only single channel 8-bit, three channel 8-bit BGR images,
-///        and continous and non-continous memory.
+/// @brief Convert a ROS2 message timestamp into UNIX microsecond timestamp, without constructing rclcpp::Time
+/// @param timestamp ROS2 message timestamp
+/// @return DV format UNIX microsecond timestamp
+[[nodiscard]] inline int64_t toDvTime(const builtin_interfaces::msg::Time &timestamp) 
+{
+	return _detail::stampToMicroseconds(timestamp);
+}
+
+/// @brief Convert OpenCV image into ROS image message in place, the data buffer of the message is reused when it
+///        is large enough. Supports only single channel 8-bit, three channel 8-bit BGR images, and continous and
+///        non-continous memory.
 ///        Performs deep data copy.
 /// @param image OpenCV image
-/// @return ROS2 image message (sensor_msgs::msg::Image)
+/// @param msg ROS2 image message to fill
 /// @throw dv::exceptions::RuntimeError if image data layout is not supported
-[[nodiscard]] inline sensor_msgs::msg::Image toRosImageMessage(const cv::Mat &image) 
+inline void toRosImageMessage(const cv::Mat &image, sensor_msgs::msg::Image &msg) 
 {
-	sensor_msgs::msg::Image msg;
-
 	msg.height = image.rows;
 	msg.width  = image.cols;
 
 	if (image.empty()) 
     {
-		return msg;
-	}
-
-	switch (image.type()) 
-    {
-		case CV_8UC1:
-			msg.encoding = sensor_msgs::image_encodings::MONO8;
-			break;
-		case CV_8UC3:
-			msg.encoding = sensor_msgs::image_encodings::BGR8;
-			break;
-		default:
-			throw dv::exceptions::RuntimeError("Received unsupported image type");
+		msg.data.clear();
+		return;
 	}
 
+	msg.encoding      = _detail::imageEncoding(image.type());
 	msg.is_bigendian  = false;
 	msg.step          = msg.width * image.elemSize();
 	const size_t size = msg.step * msg.height;
@@ -116,20 +335,65 @@ namespace _detail {
 			cv_data_ptr += image.step;
 		}
 	}
+}
+
+/// @brief Convert OpenCV image into ROS image message. Supports only single channel 8-bit, three channel 8-bit BGR images,
+///        and continous and non-continous memory.
+///        Performs deep data copy.
+/// @param image OpenCV image
+/// @return ROS2 image message (sensor_msgs::msg::Image)
+/// @throw dv::exceptions::RuntimeError if image data layout is not supported
+[[nodiscard]] inline sensor_msgs::msg::Image toRosImageMessage(const cv::Mat &image) 
+{
+	sensor_msgs::msg::Image msg;
+	toRosImageMessage(image, msg);
 	return msg;
 }
 
+///@brief Converts dv::Frame into sensor_msgs::msg::Image in place, see toRosImageMessage.
+///@param frame DV Frame containing an image.
+///@param imageMessage ROS2 image message to fill
+///@throws RuntimeError If image data layout is not supported
+inline void frameToRosImageMessage(const dv::Frame &frame, sensor_msgs::msg::Image &imageMessage) 
+{
+	toRosImageMessage(frame.image, imageMessage);
+	imageMessage.header.stamp = toRosTime(frame.timestamp);
+}
+
 ///@brief Converts dv::Frame into sensor_msgs::msg::Image.
 ///@param frame DV Frame containing an image.
 ///@return ROS2 image (sensor_msgs::msg::Image)
 ///@throws RuntimeError If image data layout is not supported
 [[nodiscard]] inline sensor_msgs::msg::Image frameToRosImageMessage(const dv::Frame &frame) 
 {
-	sensor_msgs::msg::Image imageMessage = toRosImageMessage(frame.image);
-	imageMessage.header.stamp = toRosTime(frame.timestamp);
+	sensor_msgs::msg::Image imageMessage;
+	frameToRosImageMessage(frame, imageMessage);
 	return imageMessage;
 }
 
+/// @brief Publish a message that is filled in place by the given function. If the middleware can loan the message
+///        type, the message is borrowed from the middleware, which avoids any allocation and copy with a
+///        shared-memory transport. Otherwise an owned message is published as a unique pointer, which is handed over
+///        to intra-process subscribers without a copy.
+/// @param publisher Publisher of the message
+/// @param fill Function filling the message, called with a reference to the message
+template<class MessageT, class FillFunction>
+inline void publishLoaned(rclcpp::Publisher<MessageT> &publisher, FillFunction &&fill)
+{
+	if (publisher.can_loan_messages())
+	{
+		auto loanedMessage = publisher.borrow_loaned_message();
+		fill(loanedMessage.get());
+		publisher.publish(std::move(loanedMessage));
+	}
+	else
+	{
+		auto message = std::make_unique<MessageT>();
+		fill(*message);
+		publisher.publish(std::move(message));
+	}
+}
+
 /// @brief Convert dv::IMU into sensor_msgs::Imu
 /// @param imu DV IMU measurement
 /// @return ROS Imu message
@@ -138,20 +402,134 @@ namespace _detail {
 	sensor_msgs::msg::Imu imuMessage;
 	imuMessage.header.stamp = toRosTime(imu.timestamp);
 
-    constexpr float pi = 3.14159265358979323846f;
-	constexpr float deg2rad = pi / 180.0f;
-	constexpr float earthG  = 9.81007f;
-
-	imuMessage.angular_velocity.x    = imu.gyroscopeX * deg2rad;
-	imuMessage.angular_velocity.y    = imu.gyroscopeY * deg2rad;
-	imuMessage.angular_velocity.z    = imu.gyroscopeZ * deg2rad;
-	imuMessage.linear_acceleration.x = imu.accelerometerX * earthG;
-	imuMessage.linear_acceleration.y = imu.accelerometerY * earthG;
-	imuMessage.linear_acceleration.z = imu.accelerometerZ * earthG;
+	imuMessage.angular_velocity.x    = imu.gyroscopeX * _detail::imuDeg2Rad;
+	imuMessage.angular_velocity.y    = imu.gyroscopeY * _detail::imuDeg2Rad;
+	imuMessage.angular_velocity.z    = imu.gyroscopeZ * _detail::imuDeg2Rad;
+	imuMessage.linear_acceleration.x = imu.accelerometerX * _detail::imuEarthG;
+	imuMessage.linear_acceleration.y = imu.accelerometerY * _detail::imuEarthG;
+	imuMessage.linear_acceleration.z = imu.accelerometerZ * _detail::imuEarthG;
 
 	return imuMessage;
 }
 
+/// @brief Convert a batch of dv::IMU measurements into dv_ros2_msgs::msg::ImuArray
+/// @tparam ImuRange Iterable range of dv::IMU, e.g. dv::cvector<dv::IMU> or the data of a dv-sdk IMU input
+/// @param imuBatch DV IMU measurements
+/// @return ROS2 ImuArray message, stamped with the timestamp of the last sample
+template<class ImuRange>
+[[nodiscard]] inline dv_ros2_msgs::msg::ImuArray toRosImuArrayMessage(const ImuRange &imuBatch)
+{
+	dv_ros2_msgs::msg::ImuArray msg;
+	for (const auto &imu : imuBatch)
+	{
+		msg.samples.push_back(toRosImuMessage(imu));
+	}
+	if (!msg.samples.empty())
+	{
+		msg.header.stamp = msg.samples.back().header.stamp;
+	}
+	return msg;
+}
+
+/// @brief Apply unit conversion, bias removal and rotation to a whole IMU batch in one pass. The measurements are
+///        mapped in place as strided 3xN matrices, accelerations are converted to m/s^2 and angular velocities to
+///        rad/s, the biases are subtracted and the result is rotated.
+/// @param imuBatch DV IMU measurements
+/// @param accBiases Accelerometer biases in m/s^2
+/// @param gyroBiases Gyroscope biases in rad/s
+/// @param rotation Rotation applied to both measurement vectors, e.g. from the IMU into the camera frame
+/// @param accelerations Output 3xN matrix of corrected accelerations
+/// @param angularVelocities Output 3xN matrix of corrected angular velocities
+inline void correctImuBatch(const dv::cvector<dv::IMU> &imuBatch, const Eigen::Vector3f &accBiases,
+	const Eigen::Vector3f &gyroBiases, const Eigen::Matrix3f &rotation, Eigen::Matrix3Xf &accelerations,
+	Eigen::Matrix3Xf &angularVelocities)
+{
+	static_assert(sizeof(dv::IMU) % sizeof(float) == 0);
+	static_assert(offsetof(dv::IMU, accelerometerZ) == offsetof(dv::IMU, accelerometerX) + 2 * sizeof(float));
+	static_assert(offsetof(dv::IMU, gyroscopeZ) == offsetof(dv::IMU, gyroscopeX) + 2 * sizeof(float));
+	using StridedMap = Eigen::Map<const Eigen::Matrix3Xf, Eigen::Unaligned, Eigen::OuterStride<sizeof(dv::IMU) / sizeof(float)>>;
+
+	const auto size = static_cast<Eigen::Index>(imuBatch.size());
+	if (size == 0)
+	{
+		accelerations.resize(3, 0);
+		angularVelocities.resize(3, 0);
+		return;
+	}
+
+	const StridedMap acc(&imuBatch.front().accelerometerX, 3, size);
+	const StridedMap gyro(&imuBatch.front().gyroscopeX, 3, size);
+	accelerations.noalias()     = rotation * ((acc * _detail::imuEarthG).colwise() - accBiases);
+	angularVelocities.noalias() = rotation * ((gyro * _detail::imuDeg2Rad).colwise() - gyroBiases);
+}
+
+/// @brief Convert a batch of dv::IMU measurements into dv_ros2_msgs::msg::ImuArray, removing the biases and
+///        rotating the measurements with the batch kernel correctImuBatch.
+/// @param imuBatch DV IMU measurements
+/// @param accBiases Accelerometer biases in m/s^2
+/// @param gyroBiases Gyroscope biases in rad/s
+/// @param rotation Rotation applied to both measurement vectors
+/// @return ROS2 ImuArray message, stamped with the timestamp of the last sample
+[[nodiscard]] inline dv_ros2_msgs::msg::ImuArray toRosImuArrayMessage(const dv::cvector<dv::IMU> &imuBatch,
+	const Eigen::Vector3f &accBiases, const Eigen::Vector3f &gyroBiases, const Eigen::Matrix3f &rotation)
+{
+	dv_ros2_msgs::msg::ImuArray msg;
+	if (imuBatch.empty())
+	{
+		return msg;
+	}
+
+	Eigen::Matrix3Xf accelerations;
+	Eigen::Matrix3Xf angularVelocities;
+	correctImuBatch(imuBatch, accBiases, gyroBiases, rotation, accelerations, angularVelocities);
+
+	msg.samples.resize(imuBatch.size());
+	for (size_t i = 0; i < imuBatch.size(); ++i)
+	{
+		const auto column            = static_cast<Eigen::Index>(i);
+		auto &sample                 = msg.samples[i];
+		sample.header.stamp          = toRosTime(imuBatch[i].timestamp);
+		sample.linear_acceleration.x = accelerations(0, column);
+		sample.linear_acceleration.y = accelerations(1, column);
+		sample.linear_acceleration.z = accelerations(2, column);
+		sample.angular_velocity.x    = angularVelocities(0, column);
+		sample.angular_velocity.y    = angularVelocities(1, column);
+		sample.angular_velocity.z    = angularVelocities(2, column);
+	}
+	msg.header.stamp = msg.samples.back().header.stamp;
+	return msg;
+}
+
+/// @brief Convert sensor_msgs::Imu into dv::IMU, the inverse of toRosImuMessage
+/// @param imuMessage ROS Imu message
+/// @return DV IMU measurement, accelerations in g and angular velocities in deg/s
+[[nodiscard]] inline dv::IMU toDvImu(const sensor_msgs::msg::Imu &imuMessage)
+{
+	dv::IMU imu{};
+	imu.timestamp      = _detail::stampToMicroseconds(imuMessage.header.stamp);
+	imu.accelerometerX = static_cast<float>(imuMessage.linear_acceleration.x) / _detail::imuEarthG;
+	imu.accelerometerY = static_cast<float>(imuMessage.linear_acceleration.y) / _detail::imuEarthG;
+	imu.accelerometerZ = static_cast<float>(imuMessage.linear_acceleration.z) / _detail::imuEarthG;
+	imu.gyroscopeX     = static_cast<float>(imuMessage.angular_velocity.x) / _detail::imuDeg2Rad;
+	imu.gyroscopeY     = static_cast<float>(imuMessage.angular_velocity.y) / _detail::imuDeg2Rad;
+	imu.gyroscopeZ     = static_cast<float>(imuMessage.angular_velocity.z) / _detail::imuDeg2Rad;
+	return imu;
+}
+
+/// @brief Convert dv_ros2_msgs::msg::ImuArray into a batch of dv::IMU
+/// @param message ROS2 ImuArray message
+/// @return DV IMU measurements
+[[nodiscard]] inline dv::cvector<dv::IMU> toDvImuBatch(const dv_ros2_msgs::msg::ImuArray &message)
+{
+	dv::cvector<dv::IMU> imuBatch;
+	imuBatch.reserve(message.samples.size());
+	for (const auto &sample : message.samples)
+	{
+		imuBatch.push_back(toDvImu(sample));
+	}
+	return imuBatch;
+}
+
 /// @brief Convert dv::Trigger into dv_ros2_msgs::msg::Trigger
 /// @param trigger DV Trigger
 /// @return ROS2 Trigger message
@@ -163,8 +541,43 @@ namespace _detail {
 	return msg;
 }
 
+/// @brief Convert a batch of dv::Trigger into dv_ros2_msgs::msg::TriggerArray
+/// @tparam TriggerRange Iterable range of dv::Trigger, e.g. dv::cvector<dv::Trigger> or the data of a dv-sdk trigger
+///         input
+/// @param triggers DV Triggers
+/// @return ROS2 TriggerArray message, stamped with the timestamp of the last trigger
+template<class TriggerRange>
+[[nodiscard]] inline dv_ros2_msgs::msg::TriggerArray toRosTriggerArrayMessage(const TriggerRange &triggers)
+{
+	dv_ros2_msgs::msg::TriggerArray msg;
+	for (const auto &trigger : triggers)
+	{
+		msg.triggers.push_back(toRosTriggerMessage(trigger));
+	}
+	if (!msg.triggers.empty())
+	{
+		msg.header.stamp = msg.triggers.back().timestamp;
+	}
+	return msg;
+}
 
-/// @brief Convert dv::EventStore into dv_ros2_msgs::msg::EventArray
+/// @brief Convert dv_ros2_msgs::msg::TriggerArray into a batch of dv::Trigger
+/// @param message ROS2 TriggerArray message
+/// @return DV Triggers
+[[nodiscard]] inline dv::cvector<dv::Trigger> toDvTriggers(const dv_ros2_msgs::msg::TriggerArray &message)
+{
+	dv::cvector<dv::Trigger> triggers;
+	triggers.reserve(message.triggers.size());
+	for (const auto &trigger : message.triggers)
+	{
+		triggers.emplace_back(_detail::stampToMicroseconds(trigger.timestamp), static_cast<dv::TriggerType>(trigger.type));
+	}
+	return triggers;
+}
+
+
+/// @brief Convert dv::EventStore into dv_ros2_msgs::msg::EventArray. Contiguous stores are converted in blocks by
+///        the SIMD kernel of the running CPU, see encodeEvents.
 /// @param events DV EventStore
 /// @param resolution Resolution of the sensor
 /// @return ROS2 EventArray message
@@ -173,37 +586,34 @@ namespace _detail {
 {
 	//dv_ros2_msgs::msg::EventArray msg;
 	dv_ros2_msgs::msg::EventPacket msg;
-	rclcpp::Time time = toRosTime(events.getLowestTime());
+	msg.width  = resolution.width;
+	msg.height = resolution.height;
+	if (events.isEmpty())
+	{
+		return msg;
+	}
 
-	int64_t secInMicro = static_cast<int64_t>(time.seconds()) * 1'000'000;
-	msg.header.stamp   = rclcpp::Time(static_cast<double>(events.getHighestTime()) * 1e-6);
-	msg.events.reserve(events.size());
-	for (const auto &event : events) 
-    {
-		int64_t time_diff = event.timestamp() - secInMicro;
-		if (time_diff < 1'000'000) 
-        {
-			// We are in the same second, we only need to update the nano-second part
-			time = {static_cast<uint32_t>(time.seconds()), static_cast<uint32_t>(time_diff * 1'000)};
-		}
-		else 
-        {
-			time       = toRosTime(event.timestamp());
-			secInMicro = static_cast<int64_t>(time.seconds()) * 1'000'000;
+	msg.header.stamp = toRosTime(events.getHighestTime());
+	msg.events.resize(events.size());
+	if (const dv::Event *data = _detail::contiguousEvents(events))
+	{
+		_detail::encodeEvents(data, events.size(), msg.events.data());
+	}
+	else
+	{
+		auto output = msg.events.begin();
+		for (const auto &event : events)
+		{
+			const auto second = static_cast<int32_t>(event.timestamp() / 1'000'000);
+			_detail::encodeEvent(event, static_cast<int64_t>(second) * 1'000'000, second, *output++);
 		}
-		auto &e       = msg.events.emplace_back();
-		e.x           = event.x();
-		e.y           = event.y();
-		e.polarity    = event.polarity();
-		e.ts 		  = time;
 	}
-
-	msg.width  = resolution.width;
-	msg.height = resolution.height;
 	return msg;
 }
 
-/// @brief Convert an array message into an event store.
+/// @brief Convert an array message into an event store. Timestamps are reconstructed with integer arithmetic only by
+///        the SIMD kernel of the running CPU, see decodeEvents, the ordering of the packet is validated once instead
+///        of per event.
 /// @param message Event array message
 /// @return DV Event store
 //[[nodiscard]] inline dv::EventStore toEventStore(const dv_ros2_msgs::msg::EventArray &message)
@@ -213,25 +623,431 @@ namespace _detail {
     {
 		return {};
 	}
-	uint32_t seconds                             = message.events.front().ts.sec;
-	int64_t timestamp                            = static_cast<int64_t>(seconds) * 1'000'000;
+	dv::runtime_assert(_detail::stampToMicroseconds(message.events.front().ts)
+			<= _detail::stampToMicroseconds(message.events.back().ts),
+		"Event packet timestamps are not monotonic!");
+
 	std::shared_ptr<dv::EventPacket> eventPacket = std::make_shared<dv::EventPacket>();
-	eventPacket->elements.reserve(message.events.size());
-	for (const auto &event : message.events)
-    {
-		if (event.ts.sec != seconds)
-        {
-			seconds   = event.ts.sec;
-			timestamp = static_cast<int64_t>(seconds) * 1'000'000;
+	eventPacket->elements.resize(message.events.size());
+	_detail::decodeEvents(message.events.data(), message.events.size(), eventPacket->elements.data());
+	dv::EventStore store(std::const_pointer_cast<const dv::EventPacket>(eventPacket));
+	return store;
+}
+
+/// @brief Convert dv::EventStore into the compact dv_ros2_msgs::msg::PackedEventArray. Every event is bit-packed into
+///        its pixel address, polarity and the timestamp difference to the previous event. The width of the time field
+///        is chosen per packet to minimize the packet size, differences that do not fit are escaped into a separate
+///        array. Typical packets take 3 to 4 bytes per event for VGA sensors.
+/// @param events DV EventStore
+/// @param resolution Resolution of the sensor
+/// @return ROS2 PackedEventArray message
+/// @throws InvalidArgument If an event lies outside of the resolution, its address would not fit the packed fields
+[[nodiscard]] inline dv_ros2_msgs::msg::PackedEventArray toRosPackedEventsMessage(const dv::EventStore &events, const cv::Size &resolution)
+{
+	dv_ros2_msgs::msg::PackedEventArray msg;
+	msg.width  = resolution.width;
+	msg.height = resolution.height;
+	if (events.isEmpty())
+	{
+		return msg;
+	}
+
+	const int64_t baseTimestamp = events.getLowestTime();
+	msg.header.stamp            = toRosTime(baseTimestamp);
+	msg.count                   = static_cast<uint32_t>(events.size());
+
+	// Histogram of the bit widths of the timestamp differences, the size of the packet is evaluated for every time
+	// field width without a second pass over the events. A difference escapes if it is not below the all ones value.
+	// The coordinates are validated in the same pass, before anything is written.
+	std::array<size_t, 65> widths{};
+	std::array<size_t, 65> allOnes{};
+	int64_t previous = baseTimestamp;
+	for (const auto &event : events)
+	{
+		if (event.x() < 0 || event.x() >= resolution.width)
+		{
+			throw dv::exceptions::InvalidArgument<int16_t>("Event x coordinate is outside of the resolution", event.x());
+		}
+		if (event.y() < 0 || event.y() >= resolution.height)
+		{
+			throw dv::exceptions::InvalidArgument<int16_t>("Event y coordinate is outside of the resolution", event.y());
+		}
+		const auto difference = static_cast<uint64_t>(event.timestamp() - previous);
+		const uint8_t width   = _detail::bitWidth(difference);
+		widths[width]++;
+		if (difference == _detail::lowBitMask(width))
+		{
+			allOnes[width]++;
+		}
+		previous = event.timestamp();
+	}
+
+	size_t escapes   = msg.count;
+	size_t bestCost  = std::numeric_limits<size_t>::max();
+	uint8_t timeBits = 1;
+	for (int bits = _detail::maxPackedTimeBits; bits >= 1; --bits)
+	{
+		size_t overflowing = allOnes[bits];
+		for (int width = bits + 1; width <= 64; ++width)
+		{
+			overflowing += widths[width];
+		}
+		const size_t cost = (msg.count * static_cast<size_t>(bits)) + (overflowing * 64);
+		if (cost <= bestCost)
+		{
+			bestCost = cost;
+			timeBits = static_cast<uint8_t>(bits);
+			escapes  = overflowing;
+		}
+	}
+	msg.time_bits = timeBits;
+
+	const uint8_t xBits        = _detail::bitWidth(std::max(msg.width, 1U) - 1);
+	const uint8_t yBits        = _detail::bitWidth(std::max(msg.height, 1U) - 1);
+	const uint8_t addressBits  = static_cast<uint8_t>(xBits + yBits + 1);
+	const uint64_t escapeValue = _detail::lowBitMask(timeBits);
+	msg.time_escapes.reserve(escapes);
+	msg.data.reserve(_detail::packedWordCount(msg.count, static_cast<uint8_t>(addressBits + timeBits)));
+
+	_detail::BitWriter writer(msg.data);
+	previous = baseTimestamp;
+	for (const auto &event : events)
+	{
+		const uint64_t address = static_cast<uint64_t>(static_cast<uint16_t>(event.x()))
+							   | (static_cast<uint64_t>(static_cast<uint16_t>(event.y())) << xBits)
+							   | (static_cast<uint64_t>(event.polarity() ? 1 : 0) << (xBits + yBits));
+		writer.write(address, addressBits);
+
+		const auto difference = static_cast<uint64_t>(event.timestamp() - previous);
+		if (difference < escapeValue)
+		{
+			writer.write(difference, timeBits);
+		}
+		else
+		{
+			writer.write(escapeValue, timeBits);
+			msg.time_escapes.push_back(difference);
+		}
+		previous = event.timestamp();
+	}
+	writer.flush();
+	return msg;
+}
+
+/// @brief Convert a compact packed event message into an event store.
+/// @param message Packed event array message
+/// @return DV Event store
+/// @throws InvalidArgument if the bit stream or the escaped timestamp differences do not match the event count
+[[nodiscard]] inline dv::EventStore toEventStore(const dv_ros2_msgs::msg::PackedEventArray &message)
+{
+	const size_t size = message.count;
+	if (size == 0)
+	{
+		return {};
+	}
+	if (message.time_bits == 0 || message.time_bits > _detail::maxPackedTimeBits)
+	{
+		throw dv::exceptions::InvalidArgument<int>(
+			"Packed event message has an invalid time field width", message.time_bits);
+	}
+
+	const uint8_t xBits       = _detail::bitWidth(std::max(message.width, 1U) - 1);
+	const uint8_t yBits       = _detail::bitWidth(std::max(message.height, 1U) - 1);
+	const uint8_t addressBits = static_cast<uint8_t>(xBits + yBits + 1);
+	if (message.data.size() != _detail::packedWordCount(size, static_cast<uint8_t>(addressBits + message.time_bits)))
+	{
+		throw dv::exceptions::InvalidArgument<size_t>(
+			"Packed event message bit stream does not match the event count", message.data.size());
+	}
+
+	const uint64_t escapeValue = _detail::lowBitMask(message.time_bits);
+	const uint64_t xMask       = _detail::lowBitMask(xBits);
+	const uint64_t yMask       = _detail::lowBitMask(yBits);
+	auto escape                = message.time_escapes.begin();
+	int64_t timestamp          = _detail::stampToMicroseconds(message.header.stamp);
+
+	std::shared_ptr<dv::EventPacket> eventPacket = std::make_shared<dv::EventPacket>();
+	eventPacket->elements.reserve(size);
+	_detail::BitReader reader(message.data.data(), message.data.size());
+	for (size_t i = 0; i < size; ++i)
+	{
+		const uint64_t address = reader.read(addressBits);
+		uint64_t difference    = reader.read(message.time_bits);
+		if (difference == escapeValue)
+		{
+			if (escape == message.time_escapes.end())
+			{
+				throw dv::exceptions::InvalidArgument<size_t>(
+					"Packed event message has fewer escaped timestamp differences than escaped events", i);
+			}
+			difference = *escape++;
+		}
+		timestamp += static_cast<int64_t>(difference);
+		eventPacket->elements.emplace_back(timestamp, static_cast<int16_t>(address & xMask),
+			static_cast<int16_t>((address >> xBits) & yMask), static_cast<uint8_t>((address >> (xBits + yBits)) & 1));
+	}
+	dv::EventStore store(std::const_pointer_cast<const dv::EventPacket>(eventPacket));
+	return store;
+}
+
+/// @brief Fill a fixed size BoundedEventPacket message with events of the store, starting at the given offset. The
+///        message is written in place so it can be a loaned message.
+/// @param events DV EventStore
+/// @param offset Index of the first event of the store to write
+/// @param resolution Resolution of the sensor
+/// @param msg Message to fill
+/// @return Number of events written into the message, at most BoundedEventPacket::CAPACITY
+inline size_t toRosBoundedEventsMessage(const dv::EventStore &events, const size_t offset, const cv::Size &resolution,
+	dv_ros2_msgs::msg::BoundedEventPacket &msg)
+{
+	msg.width  = resolution.width;
+	msg.height = resolution.height;
+
+	const size_t count = offset < events.size() ? std::min(events.size() - offset, msg.timestamps.size()) : 0;
+	msg.size           = static_cast<uint32_t>(count);
+	if (count == 0)
+	{
+		return 0;
+	}
+
+	const dv::EventStore slice = events.slice(offset, count);
+	msg.stamp                  = toRosTime(slice.getLowestTime());
+	size_t i                   = 0;
+	for (const auto &event : slice)
+	{
+		msg.timestamps[i] = event.timestamp();
+		msg.x[i]          = static_cast<uint16_t>(event.x());
+		msg.y[i]          = static_cast<uint16_t>(event.y());
+		msg.polarities[i] = event.polarity() ? 1 : 0;
+		i++;
+	}
+	return count;
+}
+
+/// @brief Convert a fixed size BoundedEventPacket message into an event store.
+/// @param message Bounded event packet message
+/// @return DV Event store
+/// @throws InvalidArgument if the number of valid events exceeds the capacity of the message
+[[nodiscard]] inline dv::EventStore toEventStore(const dv_ros2_msgs::msg::BoundedEventPacket &message)
+{
+	const size_t size = message.size;
+	if (size > message.timestamps.size())
+	{
+		throw dv::exceptions::InvalidArgument<size_t>("Bounded event message size exceeds its capacity", size);
+	}
+	if (size == 0)
+	{
+		return {};
+	}
+
+	std::shared_ptr<dv::EventPacket> eventPacket = std::make_shared<dv::EventPacket>();
+	eventPacket->elements.reserve(size);
+	for (size_t i = 0; i < size; ++i)
+	{
+		eventPacket->elements.emplace_back(message.timestamps[i], static_cast<int16_t>(message.x[i]),
+			static_cast<int16_t>(message.y[i]), message.polarities[i]);
+	}
+	dv::EventStore store(std::const_pointer_cast<const dv::EventPacket>(eventPacket));
+	return store;
+}
+
+/// @brief Look up the CompressedEventPacket compression constant by its name.
+/// @param name One of "none", "lz4" or "zstd"
+/// @return Compression constant, or std::nullopt for an unknown name
+[[nodiscard]] inline std::optional<uint8_t> eventCompressionFromName(const std::string &name)
+{
+	if (name == "none")
+	{
+		return dv_ros2_msgs::msg::CompressedEventPacket::COMPRESSION_NONE;
+	}
+	if (name == "lz4")
+	{
+		return dv_ros2_msgs::msg::CompressedEventPacket::COMPRESSION_LZ4;
+	}
+	if (name == "zstd")
+	{
+		return dv_ros2_msgs::msg::CompressedEventPacket::COMPRESSION_ZSTD;
+	}
+	return std::nullopt;
+}
+
+/// @brief Convert dv::EventStore into dv_ros2_msgs::msg::CompressedEventPacket. Timestamps and coordinates are delta
+///        encoded into varints, the resulting stream is optionally compressed with LZ4 or zstd.
+/// @param events DV EventStore
+/// @param resolution Resolution of the sensor
+/// @param compression Block compression, one of the CompressedEventPacket::COMPRESSION_* constants
+/// @param level Block compression level: the zstd level for zstd, the LZ4 HC level for LZ4 where values below 1
+///        select the fast LZ4 compressor
+/// @return ROS2 CompressedEventPacket message
+/// @throws InvalidArgument If the compression type is unknown
+/// @throws RuntimeError If block compression fails
+[[nodiscard]] inline dv_ros2_msgs::msg::CompressedEventPacket toRosCompressedEventsMessage(const dv::EventStore &events,
+	const cv::Size &resolution, const uint8_t compression = dv_ros2_msgs::msg::CompressedEventPacket::COMPRESSION_NONE,
+	const int level = 0)
+{
+	using Message = dv_ros2_msgs::msg::CompressedEventPacket;
+
+	Message msg;
+	msg.width       = resolution.width;
+	msg.height      = resolution.height;
+	msg.compression = compression;
+	if (events.isEmpty())
+	{
+		return msg;
+	}
+
+	const int64_t baseTimestamp = events.getLowestTime();
+	msg.header.stamp            = toRosTime(baseTimestamp);
+	msg.size                    = static_cast<uint32_t>(events.size());
+
+	std::vector<uint8_t> encoded(events.size() * _detail::maxEncodedEventSize);
+	uint8_t *output   = encoded.data();
+	int64_t timestamp = baseTimestamp;
+	int64_t x         = 0;
+	int64_t y         = 0;
+	for (const auto &event : events)
+	{
+		output = _detail::writeVarint(static_cast<uint64_t>(event.timestamp() - timestamp), output);
+		output = _detail::writeVarint(
+			(_detail::zigzagEncode(event.x() - x) << 1) | static_cast<uint64_t>(event.polarity() ? 1 : 0), output);
+		output    = _detail::writeVarint(_detail::zigzagEncode(event.y() - y), output);
+		timestamp = event.timestamp();
+		x         = event.x();
+		y         = event.y();
+	}
+	encoded.resize(static_cast<size_t>(output - encoded.data()));
+	msg.encoded_size = static_cast<uint32_t>(encoded.size());
+
+	switch (compression)
+	{
+		case Message::COMPRESSION_NONE:
+			msg.data = std::move(encoded);
+			break;
+		case Message::COMPRESSION_LZ4: {
+			const auto source = reinterpret_cast<const char *>(encoded.data());
+			const auto size   = static_cast<int>(encoded.size());
+			msg.data.resize(static_cast<size_t>(LZ4_compressBound(size)));
+			const auto destination = reinterpret_cast<char *>(msg.data.data());
+			const int compressed   = level > 0
+										 ? LZ4_compress_HC(source, destination, size, static_cast<int>(msg.data.size()), level)
+										 : LZ4_compress_default(source, destination, size, static_cast<int>(msg.data.size()));
+			if (compressed <= 0)
+			{
+				throw dv::exceptions::RuntimeError("LZ4 compression of event message failed");
+			}
+			msg.data.resize(static_cast<size_t>(compressed));
+			break;
+		}
+		case Message::COMPRESSION_ZSTD: {
+			msg.data.resize(ZSTD_compressBound(encoded.size()));
+			const size_t compressed
+				= ZSTD_compress(msg.data.data(), msg.data.size(), encoded.data(), encoded.size(), level);
+			if (ZSTD_isError(compressed))
+			{
+				throw dv::exceptions::RuntimeError("zstd compression of event message failed");
+			}
+			msg.data.resize(compressed);
+			break;
 		}
-		const int64_t eventTimestamp = timestamp + static_cast<int64_t>(event.ts.nanosec / 1000);
-		dv::runtime_assert(eventTimestamp == toDvTime(event.ts), "Timestamp conversion failed!");
-		eventPacket->elements.emplace_back(eventTimestamp, event.x, event.y, event.polarity);
+		default:
+			throw dv::exceptions::InvalidArgument<int>("Unknown event message compression", compression);
+	}
+	return msg;
+}
+
+/// @brief Convert a compressed event message into an event store.
+/// @param message Compressed event message
+/// @return DV Event store
+/// @throws InvalidArgument If the compression type is unknown or the message is corrupted
+[[nodiscard]] inline dv::EventStore toEventStore(const dv_ros2_msgs::msg::CompressedEventPacket &message)
+{
+	using Message = dv_ros2_msgs::msg::CompressedEventPacket;
+
+	if (message.size == 0)
+	{
+		return {};
+	}
+	if (message.encoded_size > static_cast<size_t>(message.size) * _detail::maxEncodedEventSize)
+	{
+		throw dv::exceptions::InvalidArgument<uint32_t>(
+			"Compressed event message stream is larger than its event count allows", message.encoded_size);
+	}
+
+	std::vector<uint8_t> decompressed;
+	switch (message.compression)
+	{
+		case Message::COMPRESSION_NONE:
+			break;
+		case Message::COMPRESSION_LZ4: {
+			decompressed.resize(message.encoded_size);
+			const int size = LZ4_decompress_safe(reinterpret_cast<const char *>(message.data.data()),
+				reinterpret_cast<char *>(decompressed.data()), static_cast<int>(message.data.size()),
+				static_cast<int>(decompressed.size()));
+			if (size != static_cast<int>(message.encoded_size))
+			{
+				throw dv::exceptions::InvalidArgument<int>("LZ4 decompression of event message failed", size);
+			}
+			break;
+		}
+		case Message::COMPRESSION_ZSTD: {
+			decompressed.resize(message.encoded_size);
+			const size_t size = ZSTD_decompress(
+				decompressed.data(), decompressed.size(), message.data.data(), message.data.size());
+			if (ZSTD_isError(size) || size != message.encoded_size)
+			{
+				throw dv::exceptions::InvalidArgument<size_t>("zstd decompression of event message failed", size);
+			}
+			break;
+		}
+		default:
+			throw dv::exceptions::InvalidArgument<int>("Unknown event message compression", message.compression);
+	}
+
+	const auto &stream   = message.compression == Message::COMPRESSION_NONE ? message.data : decompressed;
+	const uint8_t *input = stream.data();
+	const uint8_t *end   = input + stream.size();
+
+	// The event count comes from the wire, it is checked against the stream before any memory is reserved for it
+	if (static_cast<size_t>(message.size) * _detail::minEncodedEventSize > stream.size())
+	{
+		throw dv::exceptions::InvalidArgument<uint32_t>(
+			"Compressed event message count is larger than its stream can hold", message.size);
+	}
+
+	std::shared_ptr<dv::EventPacket> eventPacket = std::make_shared<dv::EventPacket>();
+	eventPacket->elements.reserve(message.size);
+	int64_t timestamp = _detail::stampToMicroseconds(message.header.stamp);
+	int64_t x         = 0;
+	int64_t y         = 0;
+	for (uint32_t i = 0; i < message.size; ++i)
+	{
+		timestamp += static_cast<int64_t>(_detail::readVarint(input, end));
+		const uint64_t xAndPolarity = _detail::readVarint(input, end);
+		x += _detail::zigzagDecode(xAndPolarity >> 1);
+		y += _detail::zigzagDecode(_detail::readVarint(input, end));
+		eventPacket->elements.emplace_back(
+			timestamp, static_cast<int16_t>(x), static_cast<int16_t>(y), static_cast<uint8_t>(xAndPolarity & 1));
 	}
 	dv::EventStore store(std::const_pointer_cast<const dv::EventPacket>(eventPacket));
 	return store;
 }
 
+/// @brief In-process representation of an EventPacket message: the event store together with the sensor resolution.
+///        Publishing and subscribing with this type through the EventPacket type adapter hands the store over to
+///        intra-process subscribers without any per-event conversion, the message is only converted when a remote
+///        subscriber exists.
+struct EventStorePacket 
+{
+	using SharedPtr      = std::shared_ptr<EventStorePacket>;
+	using ConstSharedPtr = std::shared_ptr<const EventStorePacket>;
+
+	/// @brief Events of the packet.
+	dv::EventStore events;
+
+	/// @brief Resolution of the sensor.
+	cv::Size resolution;
+};
+
 /// @brief Convert an image message from ROS2 into a dv::Frame. Allocates the memory for the image and performs
 ///        deep data copy.
 /// @param imageMsg Message to be converted.
@@ -270,3 +1086,26 @@ public:
 };
 
 } // namespace dv_ros2_msgs
+
+/// @brief Type adapter between dv_ros2_msgs::EventStorePacket and dv_ros2_msgs::msg::EventPacket. Conversion is only
+///        performed by rclcpp when the data has to cross a process boundary.
+template<>
+struct rclcpp::TypeAdapter<dv_ros2_msgs::EventStorePacket, dv_ros2_msgs::msg::EventPacket> 
+{
+	using is_specialized   = std::true_type;
+	using custom_type      = dv_ros2_msgs::EventStorePacket;
+	using ros_message_type = dv_ros2_msgs::msg::EventPacket;
+
+	static void convert_to_ros_message(const custom_type &source, ros_message_type &destination) 
+	{
+		destination = dv_ros2_msgs::toRosEventsMessage(source.events, source.resolution);
+	}
+
+	static void convert_to_custom(const ros_message_type &source, custom_type &destination) 
+	{
+		destination.events     = dv_ros2_msgs::toEventStore(source);
+		destination.resolution = cv::Size(static_cast<int>(source.width), static_cast<int>(source.height));
+	}
+};
+
+RCLCPP_USING_CUSTOM_TYPE_AS_ROS_MESSAGE_TYPE(dv_ros2_msgs::EventStorePacket, dv_ros2_msgs::msg::EventPacket);
@@ -0,0 +1,122 @@
+#include <dv_ros2_messaging/event_kernels.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+using dv_ros2_msgs::_detail::EventKernel;
+
+/// Kernels compiled into this build and supported by the running CPU, the scalar kernel is the reference.
+std::vector<EventKernel> simdKernels()
+{
+	std::vector<EventKernel> kernels;
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_AVX2)
+	if (__builtin_cpu_supports("avx2"))
+	{
+		kernels.push_back(EventKernel::Avx2);
+	}
+#endif
+#if defined(DV_ROS2_MSGS_EVENT_KERNELS_NEON)
+	kernels.push_back(EventKernel::Neon);
+#endif
+	return kernels;
+}
+
+/// Time ordered events starting at the given timestamp with random gaps, so runs cross second boundaries at varying
+/// positions within the kernel blocks.
+std::vector<dv::Event> makeEvents(const size_t size, const int64_t start, const int64_t maxGap, const uint32_t seed)
+{
+	std::mt19937 generator(seed);
+	std::uniform_int_distribution<int64_t> gap(0, maxGap);
+	std::uniform_int_distribution<int16_t> coordinate(0, 1279);
+	std::bernoulli_distribution polarity(0.5);
+
+	std::vector<dv::Event> events;
+	events.reserve(size);
+	int64_t timestamp = start;
+	for (size_t i = 0; i < size; ++i)
+	{
+		events.emplace_back(timestamp, coordinate(generator), coordinate(generator), polarity(generator));
+		timestamp += gap(generator);
+	}
+	return events;
+}
+
+void expectEqual(const dv_ros2_msgs::msg::Event &expected, const dv_ros2_msgs::msg::Event &actual, const size_t index)
+{
+	EXPECT_EQ(expected.x, actual.x) << "event " << index;
+	EXPECT_EQ(expected.y, actual.y) << "event " << index;
+	EXPECT_EQ(expected.ts.sec, actual.ts.sec) << "event " << index;
+	EXPECT_EQ(expected.ts.nanosec, actual.ts.nanosec) << "event " << index;
+	EXPECT_EQ(expected.polarity, actual.polarity) << "event " << index;
+}
+
+void expectEqual(const dv::Event &expected, const dv::Event &actual, const size_t index)
+{
+	EXPECT_EQ(expected.timestamp(), actual.timestamp()) << "event " << index;
+	EXPECT_EQ(expected.x(), actual.x()) << "event " << index;
+	EXPECT_EQ(expected.y(), actual.y()) << "event " << index;
+	EXPECT_EQ(expected.polarity(), actual.polarity()) << "event " << index;
+}
+
+/// Encode and decode with every kernel and compare against the scalar kernel and the input.
+void checkKernels(const std::vector<dv::Event> &events)
+{
+	std::vector<dv_ros2_msgs::msg::Event> reference(events.size());
+	dv_ros2_msgs::_detail::encodeEvents(events.data(), events.size(), reference.data(), EventKernel::Scalar);
+
+	std::vector<dv::Event> decoded(events.size(), dv::Event(0, 0, 0, 0));
+	dv_ros2_msgs::_detail::decodeEvents(reference.data(), reference.size(), decoded.data(), EventKernel::Scalar);
+	for (size_t i = 0; i < events.size(); ++i)
+	{
+		expectEqual(events[i], decoded[i], i);
+	}
+
+	for (const auto kernel : simdKernels())
+	{
+		SCOPED_TRACE("kernel " + std::to_string(static_cast<int>(kernel)));
+
+		std::vector<dv_ros2_msgs::msg::Event> encoded(events.size());
+		dv_ros2_msgs::_detail::encodeEvents(events.data(), events.size(), encoded.data(), kernel);
+		for (size_t i = 0; i < events.size(); ++i)
+		{
+			expectEqual(reference[i], encoded[i], i);
+		}
+
+		std::vector<dv::Event> kernelDecoded(events.size(), dv::Event(0, 0, 0, 0));
+		dv_ros2_msgs::_detail::decodeEvents(reference.data(), reference.size(), kernelDecoded.data(), kernel);
+		for (size_t i = 0; i < events.size(); ++i)
+		{
+			expectEqual(events[i], kernelDecoded[i], i);
+		}
+	}
+}
+} // namespace
+
+TEST(EventKernels, TailLengths)
+{
+	// Every remainder of the four event blocks, with and without second boundaries inside the range
+	for (size_t size = 0; size <= 67; ++size)
+	{
+		SCOPED_TRACE("size " + std::to_string(size));
+		checkKernels(makeEvents(size, 1'700'000'000'999'990, 1, static_cast<uint32_t>(size)));
+		checkKernels(makeEvents(size, 1'700'000'000'000'000, 50'000, static_cast<uint32_t>(size)));
+	}
+}
+
+TEST(EventKernels, SecondBoundaries)
+{
+	checkKernels(makeEvents(100'000, 1'700'000'000'000'000, 40, 1));
+	checkKernels(makeEvents(10'000, 1'700'000'000'999'000, 400'000, 2));
+}
+
+TEST(EventKernels, LargeTimestamps)
+{
+	// Microsecond timestamps around 2^32, and seconds around 2^31 which is the end of the message second range
+	checkKernels(makeEvents(1'000, (int64_t{1} << 32) - 500, 3, 3));
+	checkKernels(makeEvents(1'000, ((int64_t{1} << 31) - 2) * 1'000'000 + 999'000, 7, 4));
+}
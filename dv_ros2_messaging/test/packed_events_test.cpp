@@ -0,0 +1,89 @@
+#include <dv_ros2_messaging/messaging.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+
+namespace
+{
+/// Time ordered events within the given resolution, with mostly small and occasionally large timestamp gaps so that
+/// some differences escape the time field.
+dv::EventStore makeEvents(const size_t size, const cv::Size &resolution, const uint32_t seed)
+{
+	std::mt19937 generator(seed);
+	std::uniform_int_distribution<int64_t> gap(0, 20);
+	std::uniform_int_distribution<int64_t> jump(0, 5'000'000);
+	std::bernoulli_distribution escape(0.01);
+	std::uniform_int_distribution<int16_t> column(0, static_cast<int16_t>(resolution.width - 1));
+	std::uniform_int_distribution<int16_t> row(0, static_cast<int16_t>(resolution.height - 1));
+	std::bernoulli_distribution polarity(0.5);
+
+	dv::EventStore events;
+	int64_t timestamp = 1'700'000'000'000'000;
+	for (size_t i = 0; i < size; ++i)
+	{
+		events.emplace_back(timestamp, column(generator), row(generator), polarity(generator));
+		timestamp += escape(generator) ? jump(generator) : gap(generator);
+	}
+	return events;
+}
+
+void checkRoundTrip(const dv::EventStore &events, const cv::Size &resolution)
+{
+	const auto message = dv_ros2_msgs::toRosPackedEventsMessage(events, resolution);
+	EXPECT_EQ(message.width, static_cast<uint32_t>(resolution.width));
+	EXPECT_EQ(message.height, static_cast<uint32_t>(resolution.height));
+	ASSERT_EQ(message.count, events.size());
+
+	const auto decoded = dv_ros2_msgs::toEventStore(message);
+	ASSERT_EQ(decoded.size(), events.size());
+	auto expected = events.begin();
+	size_t index  = 0;
+	for (const auto &event : decoded)
+	{
+		EXPECT_EQ(expected->timestamp(), event.timestamp()) << "event " << index;
+		EXPECT_EQ(expected->x(), event.x()) << "event " << index;
+		EXPECT_EQ(expected->y(), event.y()) << "event " << index;
+		EXPECT_EQ(expected->polarity(), event.polarity()) << "event " << index;
+		++expected;
+		++index;
+	}
+}
+} // namespace
+
+TEST(PackedEvents, RoundTrip)
+{
+	checkRoundTrip(makeEvents(10'000, cv::Size(640, 480), 1), cv::Size(640, 480));
+	checkRoundTrip(makeEvents(10'000, cv::Size(346, 260), 2), cv::Size(346, 260));
+	checkRoundTrip(makeEvents(1, cv::Size(1, 1), 3), cv::Size(1, 1));
+	checkRoundTrip(dv::EventStore(), cv::Size(640, 480));
+}
+
+TEST(PackedEvents, CoordinatesOnTheBorder)
+{
+	// The last column and row use all bits of their fields, they must not spill into the neighbouring field
+	const cv::Size resolution(640, 480);
+	dv::EventStore events;
+	events.emplace_back(1'000, 639, 479, true);
+	events.emplace_back(1'001, 0, 479, false);
+	events.emplace_back(1'002, 639, 0, true);
+	checkRoundTrip(events, resolution);
+}
+
+TEST(PackedEvents, CoordinatesOutsideOfTheResolution)
+{
+	const cv::Size resolution(640, 480);
+	const auto packedWith = [&resolution](const int16_t x, const int16_t y) {
+		dv::EventStore events;
+		events.emplace_back(1'000, 10, 10, true);
+		events.emplace_back(1'001, x, y, true);
+		return dv_ros2_msgs::toRosPackedEventsMessage(events, resolution);
+	};
+
+	EXPECT_THROW(static_cast<void>(packedWith(640, 10)), dv::exceptions::InvalidArgument<int16_t>);
+	EXPECT_THROW(static_cast<void>(packedWith(10, 480)), dv::exceptions::InvalidArgument<int16_t>);
+	EXPECT_THROW(static_cast<void>(packedWith(-1, 10)), dv::exceptions::InvalidArgument<int16_t>);
+	EXPECT_THROW(static_cast<void>(packedWith(10, -1)), dv::exceptions::InvalidArgument<int16_t>);
+	EXPECT_NO_THROW(static_cast<void>(packedWith(639, 479)));
+}
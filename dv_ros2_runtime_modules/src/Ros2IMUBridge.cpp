@@ -9,6 +9,7 @@ class Ros2IMUBridge : public dv::ModuleBase
 private:
     std::shared_ptr<rclcpp::Node> node = nullptr;
     std::shared_ptr<rclcpp::Publisher<sensor_msgs::msg::Imu>> imu_pub = nullptr;
+    std::shared_ptr<rclcpp::Publisher<dv_ros2_msgs::msg::ImuArray>> imu_array_pub = nullptr;
 
 public:
     static void initInputs(dv::InputDefinitionList &in)
@@ -24,6 +25,7 @@ public:
     static void initConfigOptions(dv::RuntimeConfig &config)
     {
         config.add("topicName", dv::ConfigOption::stringOption("ROS2 Topic name", "/camera/imu"));
+        config.add("batched", dv::ConfigOption::boolOption("Publish each input packet as a single dv_ros2_msgs/ImuArray message instead of one sensor_msgs/Imu message per sample", false));
         config.setPriorityOptions({"topicName"});
     }
 
@@ -34,7 +36,7 @@ public:
 
     void run() override
     {
-        if (!imu_pub)
+        if (!imu_pub && !imu_array_pub)
         {
             if (!rclcpp::ok())
             {
@@ -47,13 +49,30 @@ public:
 
             std::string topicName = config.getString("topicName");
 
-            imu_pub = node->create_publisher<sensor_msgs::msg::Imu>(topicName, 10);
+            if (config.getBool("batched"))
+            {
+                imu_array_pub = node->create_publisher<dv_ros2_msgs::msg::ImuArray>(topicName, 10);
+            }
+            else
+            {
+                imu_pub = node->create_publisher<sensor_msgs::msg::Imu>(topicName, 10);
+            }
         }
 
         auto imuInput = inputs.getIMUInput("imu");
-        for (const auto &sample : imuInput.data())
+        if (imu_array_pub)
+        {
+            if (const auto samples = imuInput.data())
+            {
+                imu_array_pub->publish(dv_ros2_msgs::toRosImuArrayMessage(samples));
+            }
+        }
+        else
         {
-            imu_pub->publish(dv_ros2_msgs::toRosImuMessage(sample));
+            for (const auto &sample : imuInput.data())
+            {
+                imu_pub->publish(dv_ros2_msgs::toRosImuMessage(sample));
+            }
         }
         rclcpp::spin_some(node);
     }
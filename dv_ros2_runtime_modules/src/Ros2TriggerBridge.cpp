@@ -9,6 +9,7 @@ class Ros2TriggerBridge : public dv::ModuleBase
 private:
     std::shared_ptr<rclcpp::Node> node = nullptr;
     std::shared_ptr<rclcpp::Publisher<dv_ros2_msgs::msg::Trigger>> trigger_pub = nullptr;
+    std::shared_ptr<rclcpp::Publisher<dv_ros2_msgs::msg::TriggerArray>> trigger_array_pub = nullptr;
 
 public:
     static void initInputs(dv::InputDefinitionList &in)
@@ -24,6 +25,7 @@ public:
     static void initConfigOptions(dv::RuntimeConfig &config)
     {
         config.add("topicName", dv::ConfigOption::stringOption("ROS2 Topic name", "/camera/trigger"));
+        config.add("batched", dv::ConfigOption::boolOption("Publish each input packet as a single dv_ros2_msgs/TriggerArray message instead of one dv_ros2_msgs/Trigger message per trigger", false));
         config.setPriorityOptions({"topicName"});
     }
 
@@ -34,7 +36,7 @@ public:
 
     void run() override
     {
-        if (!trigger_pub)
+        if (!trigger_pub && !trigger_array_pub)
         {
             if (!rclcpp::ok())
             {
@@ -47,15 +49,29 @@ public:
 
             std::string topicName = config.getString("topicName");
 
-            trigger_pub = node->create_publisher<dv_ros2_msgs::msg::Trigger>(topicName, 10);
+            if (config.getBool("batched"))
+            {
+                trigger_array_pub = node->create_publisher<dv_ros2_msgs::msg::TriggerArray>(topicName, 10);
+            }
+            else
+            {
+                trigger_pub = node->create_publisher<dv_ros2_msgs::msg::Trigger>(topicName, 10);
+            }
         }
 
         auto triggers = inputs.getTriggerInput("sync");
         if (auto input = triggers.data())
         {
-            for (const auto &trigger : input)
+            if (trigger_array_pub)
+            {
+                trigger_array_pub->publish(dv_ros2_msgs::toRosTriggerArrayMessage(input));
+            }
+            else
             {
-                trigger_pub->publish(dv_ros2_msgs::toRosTriggerMessage(trigger));
+                for (const auto &trigger : input)
+                {
+                    trigger_pub->publish(dv_ros2_msgs::toRosTriggerMessage(trigger));
+                }
             }
         }
         rclcpp::spin_some(node);
@@ -9,9 +9,13 @@
 #include <sensor_msgs/msg/image.hpp>
 #include <sensor_msgs/msg/camera_info.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
+#include <dv_ros2_messaging/demand.hpp>
+#include <dv_ros2_messaging/image_pool.hpp>
 #include <dv_ros2_messaging/messaging.hpp>
 #include <dv_ros2_msgs/msg/event_array.hpp>
 #include <dv_ros2_msgs/msg/event_packet.hpp>
+#include <dv_ros2_msgs/msg/packed_event_array.hpp>
+#include <dv_ros2_msgs/msg/compressed_event_packet.hpp>
 #include <dv_ros2_msgs/msg/depth.hpp>
 #include <dv_ros2_msgs/msg/timed_keypoint.hpp>
 #include <dv_ros2_msgs/msg/timed_keypoint_array.hpp>
@@ -42,7 +46,12 @@ namespace dv_ros2_tracker
     public:
         /// @brief Default constructor
         /// @param t_node_name name of the node
-        Tracker(const std::string &t_node_name);
+        /// @param options node options
+        Tracker(const std::string &t_node_name, const rclcpp::NodeOptions &options = rclcpp::NodeOptions());
+
+        /// @brief Component constructor, registers the parameter callback and waits for the camera info to start tracking.
+        /// @param options node options passed by the component container
+        explicit Tracker(const rclcpp::NodeOptions &options);
 
         /// @brief Default destructor
         ~Tracker();
@@ -114,6 +123,10 @@ namespace dv_ros2_tracker
             int32_t num_intermediate_frames = 5;
             /// @brief MotionAware Tracker
             bool use_motion_compensation = false;
+            /// @brief Subscribe to the compact packed event topic instead of the event packet topic
+            bool packed_events = false;
+            /// @brief Subscribe to the compressed event topic, takes precedence over packed_events
+            bool compressed_events = false;
         };
 
         dv::features::FeatureTracks frame_tracks;
@@ -128,7 +141,11 @@ namespace dv_ros2_tracker
 
         //rclcpp::Subscription<dv_ros2_msgs::msg::EventArray>::SharedPtr m_events_array_subscriber;
 
-        rclcpp::Subscription<dv_ros2_msgs::msg::EventPacket>::SharedPtr m_events_packet_subscriber;
+        rclcpp::Subscription<dv_ros2_msgs::EventStorePacket>::SharedPtr m_events_packet_subscriber;
+
+        rclcpp::Subscription<dv_ros2_msgs::msg::PackedEventArray>::SharedPtr m_packed_events_subscriber;
+
+        rclcpp::Subscription<dv_ros2_msgs::msg::CompressedEventPacket>::SharedPtr m_compressed_events_subscriber;
 
         rclcpp::Subscription<sensor_msgs::msg::Image>::SharedPtr m_frame_subscriber;
 
@@ -146,15 +163,34 @@ namespace dv_ros2_tracker
 
         rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr m_tracks_events_frames_publisher;
 
+        /// @brief Subscriber demand of the undistorted keypoints, the keypoints are not undistorted without it
+        dv_ros2_msgs::PublisherDemand m_keypoints_undistorted_demand;
+
+        /// @brief Subscriber demand of the frame preview, the tracks are not drawn without it
+        dv_ros2_msgs::PublisherDemand m_preview_demand;
+
+        /// @brief Subscriber demand of the events preview, the accumulated frames are not fetched and drawn without it
+        dv_ros2_msgs::PublisherDemand m_events_preview_demand;
+
+        /// @brief Recycled preview image messages, shared by both previews since they have the same resolution
+        dv_ros2_msgs::ImageMessagePool m_image_pool;
+
         rclcpp::Node::SharedPtr m_node;
 
+        /// @brief Handle of the parameter callback registered by the component constructor
+        rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr m_params_callback_handle;
+
         dv::features::TrackerBase::UniquePtr m_tracker = nullptr;
 
         void stop();
 
         //void eventsArrayCallback(const dv_ros2_msgs::msg::EventArray::SharedPtr msgPtr);
         
-        void eventsPacketCallback(const dv_ros2_msgs::msg::EventPacket::SharedPtr msgPtr);
+        void eventsPacketCallback(const dv_ros2_msgs::EventStorePacket::ConstSharedPtr msgPtr);
+
+        void packedEventsCallback(const dv_ros2_msgs::msg::PackedEventArray::SharedPtr msgPtr);
+
+        void compressedEventsCallback(const dv_ros2_msgs::msg::CompressedEventPacket::SharedPtr msgPtr);
         
         void frameCallback(const sensor_msgs::msg::Image::SharedPtr msgPtr);
 
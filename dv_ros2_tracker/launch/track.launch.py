@@ -36,6 +36,8 @@ def generate_launch_description():
             output='screen',
             remappings=[
                 (f'/{track_node_name}/events', '/events'),
+                (f'/{track_node_name}/events_packed', '/events_packed'),
+                (f'/{track_node_name}/events_compressed', '/events_compressed'),
                 (f'/{track_node_name}/camera_info', '/camera_info'),            
             ],
             emulate_tty=True,
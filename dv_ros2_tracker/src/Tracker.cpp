@@ -2,8 +2,8 @@
 
 namespace dv_ros2_tracker
 {
-    Tracker::Tracker(const std::string &t_node_name)
-        : Node(t_node_name), m_node{this}
+    Tracker::Tracker(const std::string &t_node_name, const rclcpp::NodeOptions &options)
+        : Node(t_node_name, options), m_node{this, [](rclcpp::Node *) {}}
     {
         RCLCPP_INFO(m_node->get_logger(), "Constructor is initialized");
         parameterInitialization();
@@ -19,6 +19,7 @@ namespace dv_ros2_tracker
         // Publishers
         m_timed_keypoint_array_publisher = m_node->create_publisher<dv_ros2_msgs::msg::TimedKeypointArray>("keypoints", 100);
         m_timed_keypoint_undistorted_array_publisher = m_node->create_publisher<dv_ros2_msgs::msg::TimedKeypointArray>("keypoints_undistorted", 100);
+        m_keypoints_undistorted_demand.track(m_timed_keypoint_undistorted_array_publisher);
 
         // update configuration
         updateConfiguration();
@@ -28,13 +29,39 @@ namespace dv_ros2_tracker
         m_frame_tracks.setTrackTimeout(std::chrono::milliseconds(10));
     }
 
+    Tracker::Tracker(const rclcpp::NodeOptions &options)
+        : Tracker("dv_ros2_tracker", options)
+    {
+        m_params_callback_handle = add_on_set_parameters_callback(std::bind(&Tracker::paramsCallback, this, std::placeholders::_1));
+    }
+
     Tracker::~Tracker()
     {
         stop();
     }
 
     //void Tracker::eventsArrayCallback(const dv_ros2_msgs::msg::EventArray::SharedPtr msgPtr)
-    void Tracker::eventsPacketCallback(const dv_ros2_msgs::msg::EventPacket::SharedPtr msgPtr)
+    void Tracker::eventsPacketCallback(const dv_ros2_msgs::EventStorePacket::ConstSharedPtr msgPtr)
+    {
+        if (msgPtr == nullptr)
+        {
+            return;
+        }
+        // The store shares the packets of the message, queuing it copies only their pointers
+        m_data_queue.push(msgPtr->events);
+    }
+
+    void Tracker::packedEventsCallback(const dv_ros2_msgs::msg::PackedEventArray::SharedPtr msgPtr)
+    {
+        if (msgPtr == nullptr)
+        {
+            return;
+        }
+        auto events = dv_ros2_msgs::toEventStore(*msgPtr);
+        m_data_queue.push(std::move(events));
+    }
+
+    void Tracker::compressedEventsCallback(const dv_ros2_msgs::msg::CompressedEventPacket::SharedPtr msgPtr)
     {
         if (msgPtr == nullptr)
         {
@@ -144,7 +171,19 @@ namespace dv_ros2_tracker
         if (mode == OperationMode::EventsOnly || mode == OperationMode::Combined
             || mode == OperationMode::EventsOnlyCompensated || mode == OperationMode::CombinedCompensated) {
            //m_events_array_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::EventArray>("events", 10, std::bind(&Tracker::eventsArrayCallback, this, std::placeholders::_1));
-            m_events_packet_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::EventPacket>("events", 10, std::bind(&Tracker::eventsPacketCallback, this, std::placeholders::_1));RCLCPP_INFO(m_node->get_logger(), "Subscribing to event stream..");
+            if (m_params.compressed_events)
+            {
+                m_compressed_events_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::CompressedEventPacket>("events_compressed", 10, std::bind(&Tracker::compressedEventsCallback, this, std::placeholders::_1));
+            }
+            else if (m_params.packed_events)
+            {
+                m_packed_events_subscriber = m_node->create_subscription<dv_ros2_msgs::msg::PackedEventArray>("events_packed", 10, std::bind(&Tracker::packedEventsCallback, this, std::placeholders::_1));
+            }
+            else
+            {
+                m_events_packet_subscriber = m_node->create_subscription<dv_ros2_msgs::EventStorePacket>("events", 10, std::bind(&Tracker::eventsPacketCallback, this, std::placeholders::_1));
+            }
+            RCLCPP_INFO(m_node->get_logger(), "Subscribing to event stream..");
         }
         if (mode == OperationMode::FramesOnlyCompensated || mode == OperationMode::EventsOnlyCompensated
             || mode == OperationMode::CombinedCompensated) {
@@ -344,7 +383,10 @@ namespace dv_ros2_tracker
             frame_tracks.accept(tracks);
             m_timed_keypoint_array_publisher->publish(toRosTimedKeypointArrayMessage(tracks->timestamp, tracks->keypoints));
 
-            m_timed_keypoint_undistorted_array_publisher->publish(toRosTimedKeypointArrayMessage(tracks->timestamp, undistortKeypoints(tracks->keypoints)));
+            if (m_keypoints_undistorted_demand.poll() != dv_ros2_msgs::PublisherDemand::State::Idle)
+            {
+                m_timed_keypoint_undistorted_array_publisher->publish(toRosTimedKeypointArrayMessage(tracks->timestamp, undistortKeypoints(tracks->keypoints)));
+            }
             return true;
         }
         return false;
@@ -352,17 +394,18 @@ namespace dv_ros2_tracker
 
     void Tracker::publishEventsPreview(const cv::Mat &background)
     {
-        if (m_tracks_events_frames_publisher->get_subscription_count() > 0 && !background.empty())
+        // The demand was polled by the caller before fetching the accumulated frame
+        if (m_events_preview_demand.active() && !background.empty())
         {
-            m_tracks_events_frames_publisher->publish(dv_ros2_msgs::toRosImageMessage(frame_tracks.visualize(background)));
+            m_image_pool.publish(*m_tracks_events_frames_publisher, frame_tracks.visualize(background), builtin_interfaces::msg::Time());
         }
     }
 
     void Tracker::publishPreview(const cv::Mat &background)
     {
-        if (m_tracks_preview_publisher->get_subscription_count() > 0 && !background.empty())
+        if (m_preview_demand.poll() != dv_ros2_msgs::PublisherDemand::State::Idle && !background.empty())
         {
-            m_tracks_preview_publisher->publish(dv_ros2_msgs::toRosImageMessage(frame_tracks.visualize(background)));
+            m_image_pool.publish(*m_tracks_preview_publisher, frame_tracks.visualize(background), builtin_interfaces::msg::Time());
         }
     }
 
@@ -374,6 +417,10 @@ namespace dv_ros2_tracker
             {
                 pushEventToTracker(events);
                 while (runTracking()) {
+                    if (m_events_preview_demand.poll() == dv_ros2_msgs::PublisherDemand::State::Idle)
+                    {
+                        continue;
+                    }
                     cv::Mat accumulatedImage
                         = dynamic_cast<dv::features::EventFeatureLKTracker<dv::EdgeMapAccumulator> *>(m_tracker.get())
                             ->getAccumulatedFrame();
@@ -390,12 +437,15 @@ namespace dv_ros2_tracker
                 while (!m_queue_frame.empty() && m_queue_frame.front().frame.timestamp < m_last_events_timestamp) {
                     pushFrameToTracker(m_queue_frame.front().frame);
                     runTracking();
-                    auto frames = dynamic_cast<dv::features::EventCombinedLKTracker<dv::EdgeMapAccumulator> *>(m_tracker.get())
-                                    ->getAccumulatedFrames();
-                    if (!frames.empty()) {
-                        cv::Mat accumulatedImage = frames.back().pyramid.front();
-                        // publish accumulated image
-                        publishEventsPreview(accumulatedImage);
+                    if (m_events_preview_demand.poll() != dv_ros2_msgs::PublisherDemand::State::Idle)
+                    {
+                        auto frames = dynamic_cast<dv::features::EventCombinedLKTracker<dv::EdgeMapAccumulator> *>(m_tracker.get())
+                                        ->getAccumulatedFrames();
+                        if (!frames.empty()) {
+                            cv::Mat accumulatedImage = frames.back().pyramid.front();
+                            // publish accumulated image
+                            publishEventsPreview(accumulatedImage);
+                        }
                     }
                     // publish the tracks on the frame
                     publishPreview(m_queue_frame.front().frame.image);
@@ -461,6 +511,10 @@ namespace dv_ros2_tracker
                     m_queue_event_store.pop();
                     while (runTracking()) 
                     {
+                        if (m_events_preview_demand.poll() == dv_ros2_msgs::PublisherDemand::State::Idle)
+                        {
+                            continue;
+                        }
                         cv::Mat accumulatedImage
                             = dynamic_cast<dv::features::EventFeatureLKTracker<dv::kinematics::MotionCompensator<>> *>(m_tracker.get())
                                 ->getAccumulatedFrame();
@@ -483,13 +537,16 @@ namespace dv_ros2_tracker
                         pushFrameToTracker(m_queue_frame.front().frame);
                         // perform tracking and publish the results
                         runTracking();
-                        auto tmpTracker = dynamic_cast<dv::features::EventCombinedLKTracker<dv::kinematics::MotionCompensator<>> *>(
-                            m_tracker.get());
-                        auto frames = tmpTracker->getAccumulatedFrames();
-                        if (!frames.empty()) 
+                        if (m_events_preview_demand.poll() != dv_ros2_msgs::PublisherDemand::State::Idle)
                         {
-                            cv::Mat accumulatedImage = frames.back().pyramid.front();
-                            publishEventsPreview(accumulatedImage);
+                            auto tmpTracker = dynamic_cast<dv::features::EventCombinedLKTracker<dv::kinematics::MotionCompensator<>> *>(
+                                m_tracker.get());
+                            auto frames = tmpTracker->getAccumulatedFrames();
+                            if (!frames.empty()) 
+                            {
+                                cv::Mat accumulatedImage = frames.back().pyramid.front();
+                                publishEventsPreview(accumulatedImage);
+                            }
                         }
                         publishPreview(m_queue_frame.front().frame.image);
 
@@ -539,7 +596,11 @@ namespace dv_ros2_tracker
     {
         RCLCPP_INFO(m_node->get_logger(), "Stopping the tracking node...");
         m_spin_thread = false;
-        m_keypoints_thread.join();
+        if (m_keypoints_thread.joinable())
+        {
+            m_keypoints_thread.join();
+        }
+        RCLCPP_INFO_STREAM(m_node->get_logger(), "Image message pool: " << m_image_pool.hits() << " hits, " << m_image_pool.misses() << " misses.");
     }
        
 
@@ -594,6 +655,11 @@ namespace dv_ros2_tracker
         m_node->declare_parameter("num_intermediate_frames", m_params.num_intermediate_frames, descriptor);
         descriptor.set__description("MotionAware Tracker");
         m_node->declare_parameter("use_motion_compensation", m_params.use_motion_compensation, descriptor);
+        descriptor.set__description("Subscribe to the compact packed event topic instead of the event packet topic");
+        descriptor.read_only = true;
+        m_node->declare_parameter("packed_events", m_params.packed_events, descriptor);
+        descriptor.set__description("Subscribe to the compressed event topic, takes precedence over packed_events");
+        m_node->declare_parameter("compressed_events", m_params.compressed_events, descriptor);
     }
 
     inline void Tracker::parameterPrinter() const
@@ -613,6 +679,8 @@ namespace dv_ros2_tracker
         RCLCPP_INFO(m_node->get_logger(), "accumulation_framerate: %d", m_params.accumulation_framerate);
         RCLCPP_INFO(m_node->get_logger(), "num_intermediate_frames: %d", m_params.num_intermediate_frames);
         RCLCPP_INFO(m_node->get_logger(), "use_motion_compensation: %s", m_params.use_motion_compensation ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "packed_events: %s", m_params.packed_events ? "true" : "false");
+        RCLCPP_INFO(m_node->get_logger(), "compressed_events: %s", m_params.compressed_events ? "true" : "false");
         RCLCPP_INFO(m_node->get_logger(), "-----------------------------");
     }
 
@@ -688,27 +756,46 @@ namespace dv_ros2_tracker
             RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter use_motion_compensation");
             return false;
         }
+        if (!m_node->get_parameter("packed_events", m_params.packed_events))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter packed_events");
+            return false;
+        }
+        if (!m_node->get_parameter("compressed_events", m_params.compressed_events))
+        {
+            RCLCPP_ERROR(m_node->get_logger(), "Failed to read parameter compressed_events");
+            return false;
+        }
         return true;
     }
 
     void Tracker::updateConfiguration()
     {
+        // Preview publishers are created once, before switching to an operation mode that polls their demand, so
+        // that reconfiguration keeps the existing subscribers
+        if (m_params.use_frames && m_tracks_preview_publisher == nullptr)
+        {
+            m_tracks_preview_publisher = m_node->create_publisher<sensor_msgs::msg::Image>("preview/image", 10);
+            m_preview_demand.track(m_tracks_preview_publisher);
+        }
+        if (m_params.use_events && m_tracks_events_frames_publisher == nullptr)
+        {
+            m_tracks_events_frames_publisher = m_node->create_publisher<sensor_msgs::msg::Image>("events_preview/image", 10);
+            m_events_preview_demand.track(m_tracks_events_frames_publisher);
+        }
+
         // Define the operation mode
         if (m_params.use_events && m_params.use_frames)
         {
             mode = OperationMode::Combined;
-            m_tracks_preview_publisher = m_node->create_publisher<sensor_msgs::msg::Image>("preview/image", 10);
-            m_tracks_events_frames_publisher = m_node->create_publisher<sensor_msgs::msg::Image>("events_preview/image", 10);
         }
         else if (m_params.use_events)
         {
             mode = OperationMode::EventsOnly;
-            m_tracks_events_frames_publisher = m_node->create_publisher<sensor_msgs::msg::Image>("events_preview/image", 10);
         }
         else if (m_params.use_frames)
         {
             mode = OperationMode::FramesOnly;
-            m_tracks_preview_publisher = m_node->create_publisher<sensor_msgs::msg::Image>("preview/image", 10);
         }
         else
         {
@@ -915,3 +1002,5 @@ namespace dv_ros2_tracker
     }
 } // namespace dv_ros2_tracker
 
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(dv_ros2_tracker::Tracker)
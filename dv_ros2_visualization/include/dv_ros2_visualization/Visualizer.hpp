@@ -14,6 +14,10 @@
 #include "dv_ros2_msgs/msg/event.hpp"
 #include "dv_ros2_msgs/msg/event_array.hpp"
 #include "dv_ros2_msgs/msg/event_packet.hpp"
+#include "dv_ros2_msgs/msg/packed_event_array.hpp"
+#include "dv_ros2_msgs/msg/compressed_event_packet.hpp"
+#include "dv_ros2_messaging/demand.hpp"
+#include "dv_ros2_messaging/image_pool.hpp"
 #include "dv_ros2_messaging/messaging.hpp"
 
 namespace dv_ros2_visualization
@@ -36,6 +40,10 @@ namespace dv_ros2_visualization
         int16_t negative_event_color_r;
         int16_t negative_event_color_g;
         int16_t negative_event_color_b;
+        /// @brief subscribe to the compact packed event topic instead of the event packet topic
+        bool packed_events = false;
+        /// @brief subscribe to the compressed event topic, takes precedence over packed_events
+        bool compressed_events = false;
     };
 
     class Visualizer : public rclcpp::Node
@@ -44,7 +52,12 @@ namespace dv_ros2_visualization
     public:
         /// @brief Default constructor
         /// @param t_node_name name of the node
-        Visualizer(const std::string &t_node_name);
+        /// @param options node options
+        Visualizer(const std::string &t_node_name, const rclcpp::NodeOptions &options = rclcpp::NodeOptions());
+
+        /// @brief Component constructor, registers the parameter callback and starts the node.
+        /// @param options node options passed by the component container
+        explicit Visualizer(const rclcpp::NodeOptions &options);
 
         /// @brief Shallow copy constructor
         /// @param source source object to copy from
@@ -86,7 +99,25 @@ namespace dv_ros2_visualization
         /// @brief Event callback function for populating queue
         /// @param events EventArray message
         //void eventCallback(dv_ros2_msgs::msg::EventArray::SharedPtr events);
-        void eventCallback(dv_ros2_msgs::msg::EventPacket::SharedPtr events);
+        void eventCallback(dv_ros2_msgs::EventStorePacket::ConstSharedPtr events);
+
+        /// @brief Packed event callback function for populating queue
+        /// @param events PackedEventArray message
+        void packedEventCallback(dv_ros2_msgs::msg::PackedEventArray::SharedPtr events);
+
+        /// @brief Compressed event callback function for populating queue
+        /// @param events CompressedEventPacket message
+        void compressedEventCallback(dv_ros2_msgs::msg::CompressedEventPacket::SharedPtr events);
+
+        /// @brief Pass the received events to the slicer, creates the visualizer on first call
+        /// @param resolution Resolution of the sensor
+        /// @param store Received events
+        void acceptEvents(const cv::Size &resolution, const dv::EventStore &store);
+
+        /// @brief Poll the subscribers of the frame publisher, restarts the slicer when the first subscriber appears
+        /// @return True if the received events have to be visualized, false if nobody listens to the frames
+        bool hasDemand();
+
         /// @brief Parameters
         Params m_params;
 
@@ -99,11 +130,26 @@ namespace dv_ros2_visualization
 
         /// @brief EventArray subscriber
         //rclcpp::Subscription<dv_ros2_msgs::msg::EventArray>::SharedPtr m_events_subscriber;
-        rclcpp::Subscription<dv_ros2_msgs::msg::EventPacket>::SharedPtr m_events_subscriber;
+        rclcpp::Subscription<dv_ros2_msgs::EventStorePacket>::SharedPtr m_events_subscriber;
+
+        /// @brief PackedEventArray subscriber
+        rclcpp::Subscription<dv_ros2_msgs::msg::PackedEventArray>::SharedPtr m_packed_events_subscriber;
+
+        /// @brief CompressedEventPacket subscriber
+        rclcpp::Subscription<dv_ros2_msgs::msg::CompressedEventPacket>::SharedPtr m_compressed_events_subscriber;
 
         /// @brief Frame publisher
         rclcpp::Publisher<sensor_msgs::msg::Image>::SharedPtr m_frame_publisher;
 
+        /// @brief Subscriber demand of the frame publisher, no events are sliced or rendered without it
+        dv_ros2_msgs::PublisherDemand m_frame_demand;
+
+        /// @brief Recycled image messages, avoids a buffer allocation for every published frame
+        dv_ros2_msgs::ImageMessagePool m_image_pool;
+
+        /// @brief Handle of the parameter callback registered by the component constructor
+        rclcpp::node_interfaces::OnSetParametersCallbackHandle::SharedPtr m_params_callback_handle;
+
         /// @brief Event queue
         boost::lockfree::spsc_queue<dv::EventStore> m_event_queue{100};
 
@@ -51,6 +51,8 @@ def generate_launch_description():
             emulate_tty=True,
             remappings=[
                 (f'/{acc_node_name}_frame/events', '/events'),            
+                (f'/{acc_node_name}_frame/events_packed', '/events_packed'),
+                (f'/{acc_node_name}_frame/events_compressed', '/events_compressed'),
             ]
         ),  
         Node(
@@ -63,6 +65,8 @@ def generate_launch_description():
             emulate_tty=True,
             remappings=[
                 (f'/{acc_node_name}_edge/events', '/events'),            
+                (f'/{acc_node_name}_edge/events_packed', '/events_packed'),
+                (f'/{acc_node_name}_edge/events_compressed', '/events_compressed'),
             ]
         ),
         Node(
@@ -75,6 +79,8 @@ def generate_launch_description():
             emulate_tty=True,
             remappings=[
                 (f'/{vis_node_name}/events', '/events'),            
+                (f'/{vis_node_name}/events_packed', '/events_packed'),
+                (f'/{vis_node_name}/events_compressed', '/events_compressed'),
             ]
         ),
         Node(
@@ -86,6 +92,8 @@ def generate_launch_description():
             output='screen',
             remappings=[
                 (f'/{track_node_name}/events', '/events'),
+                (f'/{track_node_name}/events_packed', '/events_packed'),
+                (f'/{track_node_name}/events_compressed', '/events_compressed'),
                 (f'/{track_node_name}/camera_info', '/camera_info'),            
             ],
             emulate_tty=True,
@@ -37,6 +37,8 @@ def generate_launch_description():
             emulate_tty=True,
             remappings=[
                 (f'/{vis_node_name}/events', '/events'),            
+                (f'/{vis_node_name}/events_packed', '/events_packed'),
+                (f'/{vis_node_name}/events_compressed', '/events_compressed'),
             ]
         ),
         Node(
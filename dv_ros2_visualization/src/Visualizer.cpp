@@ -2,7 +2,7 @@
 
 namespace dv_ros2_visualization
 {
-    Visualizer::Visualizer(const std::string &t_node_name) : Node(t_node_name)
+    Visualizer::Visualizer(const std::string &t_node_name, const rclcpp::NodeOptions &options) : Node(t_node_name, options)
     {
         //RCLCPP_INFO(m_node->get_logger(), "Constructor is initialized.");
         RCLCPP_INFO(this->get_logger(), "Constructor is initialized.");
@@ -21,13 +21,34 @@ namespace dv_ros2_visualization
         m_slicer = std::make_unique<dv::EventStreamSlicer>();
         //m_events_subscriber = this->create_subscription<dv_ros2_msgs::msg::EventArray>(
         //    "events", 10, std::bind(&Visualizer::eventCallback, this, std::placeholders::_1));
-        m_events_subscriber = this->create_subscription<dv_ros2_msgs::msg::EventPacket>(
-            "events", 10, std::bind(&Visualizer::eventCallback, this, std::placeholders::_1));
+        if (m_params.compressed_events)
+        {
+            m_compressed_events_subscriber = this->create_subscription<dv_ros2_msgs::msg::CompressedEventPacket>(
+                "events_compressed", 10, std::bind(&Visualizer::compressedEventCallback, this, std::placeholders::_1));
+        }
+        else if (m_params.packed_events)
+        {
+            m_packed_events_subscriber = this->create_subscription<dv_ros2_msgs::msg::PackedEventArray>(
+                "events_packed", 10, std::bind(&Visualizer::packedEventCallback, this, std::placeholders::_1));
+        }
+        else
+        {
+            m_events_subscriber = this->create_subscription<dv_ros2_msgs::EventStorePacket>(
+                "events", 10, std::bind(&Visualizer::eventCallback, this, std::placeholders::_1));
+        }
         m_frame_publisher = this->create_publisher<sensor_msgs::msg::Image>(m_params.image_topic, 10);
+        m_frame_demand.track(m_frame_publisher);
 
         RCLCPP_INFO(this->get_logger(), "Sucessfully launched.");
     }
 
+    Visualizer::Visualizer(const rclcpp::NodeOptions &options)
+    : Visualizer("dv_ros2_visualization", options)
+    {
+        m_params_callback_handle = add_on_set_parameters_callback(std::bind(&Visualizer::paramsCallback, this, std::placeholders::_1));
+        start();
+    }
+
     void Visualizer::start()
     {
         m_visualization_thread = std::thread(&Visualizer::visualize, this);
@@ -39,6 +60,7 @@ namespace dv_ros2_visualization
         RCLCPP_INFO(this->get_logger(), "Stopping the visualization node...");
         m_spin_thread = false;
         m_visualization_thread.join();
+        RCLCPP_INFO_STREAM(this->get_logger(), "Image message pool: " << m_image_pool.hits() << " hits, " << m_image_pool.misses() << " misses.");
     }
 
     bool Visualizer::isRunning() const
@@ -47,14 +69,40 @@ namespace dv_ros2_visualization
     }
 
     //void Visualizer::eventCallback(dv_ros2_msgs::msg::EventArray::SharedPtr events)
-    void Visualizer::eventCallback(dv_ros2_msgs::msg::EventPacket::SharedPtr events){
+    void Visualizer::eventCallback(dv_ros2_msgs::EventStorePacket::ConstSharedPtr events){
+        if (!hasDemand())
+        {
+            return;
+        }
+        acceptEvents(events->resolution, events->events);
+    }
+
+    void Visualizer::packedEventCallback(dv_ros2_msgs::msg::PackedEventArray::SharedPtr events)
+    {
+        if (!hasDemand())
+        {
+            return;
+        }
+        acceptEvents(cv::Size(events->width, events->height), dv_ros2_msgs::toEventStore(*events));
+    }
+
+    void Visualizer::compressedEventCallback(dv_ros2_msgs::msg::CompressedEventPacket::SharedPtr events)
+    {
+        if (!hasDemand())
+        {
+            return;
+        }
+        acceptEvents(cv::Size(events->width, events->height), dv_ros2_msgs::toEventStore(*events));
+    }
+
+    void Visualizer::acceptEvents(const cv::Size &resolution, const dv::EventStore &store)
+    {
         if (m_visualizer == nullptr)
         {
-            m_visualizer = std::make_unique<dv::visualization::EventVisualizer>(cv::Size(events->width, events->height));
+            m_visualizer = std::make_unique<dv::visualization::EventVisualizer>(resolution);
             updateConfiguration();
         }
 
-        auto store = dv_ros2_msgs::toEventStore(*events);
         try
         {
             m_slicer->accept(store);
@@ -65,6 +113,28 @@ namespace dv_ros2_visualization
         }
     }
 
+    bool Visualizer::hasDemand()
+    {
+        switch (m_frame_demand.poll())
+        {
+            case dv_ros2_msgs::PublisherDemand::State::Idle:
+                return false;
+            case dv_ros2_msgs::PublisherDemand::State::Resumed:
+                // Start slicing from the next received events, the time job would otherwise emit every interval
+                // skipped while idle
+                RCLCPP_INFO(this->get_logger(), "Frame subscriber connected, resuming visualization.");
+                m_slicer = std::make_unique<dv::EventStreamSlicer>();
+                m_job_id.reset();
+                if (m_visualizer != nullptr)
+                {
+                    updateConfiguration();
+                }
+                return true;
+            default:
+                return true;
+        }
+    }
+
     void Visualizer::slicerCallback(const dv::EventStore &events)
     {
         m_event_queue.push(events);
@@ -95,12 +165,11 @@ namespace dv_ros2_visualization
         {
             m_event_queue.consume_all([&](const dv::EventStore &events)
             {
-                if (m_visualizer != nullptr)
+                // Slices left over from before the last subscriber disconnected are dropped
+                if (m_visualizer != nullptr && m_frame_demand.active())
                 {
                     cv::Mat image = m_visualizer->generateImage(events);
-                    sensor_msgs::msg::Image msg = dv_ros2_msgs::toRosImageMessage(image);
-                    msg.header.stamp = dv_ros2_msgs::toRosTime(events.getLowestTime());
-                    m_frame_publisher->publish(msg);
+                    m_image_pool.publish(*m_frame_publisher, image, dv_ros2_msgs::toRosTime(events.getLowestTime()));
                 }
             });
             std::this_thread::sleep_for(std::chrono::microseconds(100));
@@ -111,7 +180,6 @@ namespace dv_ros2_visualization
     {
         RCLCPP_INFO(this->get_logger(), "Destructor is activated.");
         stop();
-        rclcpp::shutdown();
     }
 
     //inline void Visualizer::parameterInitilization() const
@@ -136,6 +204,10 @@ namespace dv_ros2_visualization
         this->declare_parameter("negative_event_color_r", m_params.negative_event_color_r, descriptor);
         this->declare_parameter("negative_event_color_g", m_params.negative_event_color_g, descriptor);
         this->declare_parameter("negative_event_color_b", m_params.negative_event_color_b, descriptor);
+        rcl_interfaces::msg::ParameterDescriptor read_only_descriptor;
+        read_only_descriptor.read_only = true;
+        this->declare_parameter<bool>("packed_events", m_params.packed_events, read_only_descriptor);
+        this->declare_parameter<bool>("compressed_events", m_params.compressed_events, read_only_descriptor);
     }
 
     inline void Visualizer::parameterPrinter() const
@@ -152,6 +224,8 @@ namespace dv_ros2_visualization
         RCLCPP_INFO(this->get_logger(), "negative_event_color_r: %d", m_params.negative_event_color_r);
         RCLCPP_INFO(this->get_logger(), "negative_event_color_g: %d", m_params.negative_event_color_g);
         RCLCPP_INFO(this->get_logger(), "negative_event_color_b: %d", m_params.negative_event_color_b);
+        RCLCPP_INFO(this->get_logger(), "packed_events: %s", m_params.packed_events ? "true" : "false");
+        RCLCPP_INFO(this->get_logger(), "compressed_events: %s", m_params.compressed_events ? "true" : "false");
     }
 
     inline bool Visualizer::readParameters()
@@ -211,6 +285,16 @@ namespace dv_ros2_visualization
             RCLCPP_ERROR(this->get_logger(), "Failed to read paramter negative_event_color_b.");
             return false;
         }
+        if (!this->get_parameter("packed_events", m_params.packed_events))
+        {
+            RCLCPP_ERROR(this->get_logger(), "Failed to read paramter packed_events.");
+            return false;
+        }
+        if (!this->get_parameter("compressed_events", m_params.compressed_events))
+        {
+            RCLCPP_ERROR(this->get_logger(), "Failed to read paramter compressed_events.");
+            return false;
+        }
         return true;
     }
 
@@ -365,4 +449,7 @@ namespace dv_ros2_visualization
     }
 
 
-} // namespace dv_ros2_visualization
\ No newline at end of file
+} // namespace dv_ros2_visualization
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(dv_ros2_visualization::Visualizer)